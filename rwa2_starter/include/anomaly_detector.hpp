@@ -0,0 +1,146 @@
+/**
+ * @file    anomaly_detector.hpp
+ * @author  Chris Collins
+ * @brief   Rolling-window anomaly detector for per-frame sensor values (LIDAR average, brightness, IMU rotation).
+ *          Scores each new sample against its recent history with a mean/std z-score or a robust median/MAD
+ *          score and emits the timestamps of frames that deviate past a threshold.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Scoring method used by the AnomalyDetector
+ *
+ */
+enum class AnomalyMethod {
+  ZScore,    // |x - mean| / std (sample, n - 1) over the rolling window
+  MedianMad  // 0.6745 * |x - median| / MAD over the rolling window (robust to outliers in history)
+};
+
+/**
+ * @brief Value channels produced by the rwa2 processing loop, one stream per channel per robot
+ *
+ */
+enum AnomalyChannel : std::size_t {
+  anomaly_lidar_channel      = 0,  // Average LIDAR distance [m]
+  anomaly_brightness_channel = 1,  // Average Camera brightness
+  anomaly_rotation_channel   = 2,  // Total IMU rotation [deg]
+  anomaly_channel_count      = 3
+};
+
+/**
+ * @brief Display name of an anomaly channel
+ *
+ * @param channel Channel index (stream % anomaly_channel_count)
+ * @return const char*
+ */
+inline const char* anomaly_channel_name(std::size_t channel) {
+  switch (channel) {
+    case anomaly_lidar_channel:      return "LIDAR";
+    case anomaly_brightness_channel: return "Camera";
+    case anomaly_rotation_channel:   return "IMU";
+    default:                         return "Unknown";
+  }
+}
+
+/**
+ * @brief Detector configuration
+ *
+ */
+struct AnomalyConfig {
+  std::size_t   window{8};                      // Number of past samples kept per stream
+  std::size_t   min_history{4};                 // Samples required in the window before a stream is scored (>= 2)
+  double        threshold{3.0};                 // Score above which a sample is flagged (z-score: for a long history)
+  AnomalyMethod method{AnomalyMethod::ZScore};  // Scoring method
+};
+
+/**
+ * @brief A flagged sample: which frame, which stream, and how far it deviated
+ *
+ */
+struct AnomalyEvent {
+  int         timestamp;  // Timestamp ID of the flagged frame
+  std::size_t stream;     // Stream index (robot * anomaly_channel_count + channel)
+  double      score;      // Score that crossed the threshold
+};
+
+/**
+ * @brief Rolling-window anomaly detector over many independent value streams
+ *
+ * History is stored slot-major ([window slot][stream]) so every per-sample pass (score, flag, running-sum update)
+ * is a contiguous loop over streams that the compiler vectorizes. Z-score mode keeps running sums so each update is
+ * O(streams) regardless of window size; MAD mode sorts each stream's window and is meant for small windows.
+ * Z-score thresholds are raised for short histories (Student's t) so a new stream is not flagged more often than a
+ * warmed-up one; the per-history-size thresholds are computed once in the constructor.
+ * All buffers are allocated once in the constructor, nothing allocates per frame except appending flagged events.
+ */
+class AnomalyDetector {
+ public:
+  /**
+   * @brief Construct a detector for a fixed number of streams
+   *
+   * @param num_streams Number of independent value streams (e.g. robots * anomaly_channel_count)
+   * @param config      Window, threshold and scoring method
+   */
+  AnomalyDetector(std::size_t num_streams, const AnomalyConfig& config);
+
+  /**
+   * @brief Score one sample per stream against history, then add the samples to history
+   *
+   * @param timestamp Timestamp ID shared by all samples
+   * @param values    num_streams values, one per stream
+   * @param flagged   Flagged samples are appended here
+   * @return std::size_t Number of streams flagged for this timestamp
+   */
+  std::size_t update(int timestamp, const double* values, std::vector<AnomalyEvent>& flagged);
+
+  /**
+   * @brief Run update() over a batch of frames stored frame-major ([frame][stream])
+   *
+   * @param timestamps Timestamp ID of each frame
+   * @param values     num_frames * num_streams values
+   * @param num_frames Number of frames in the batch
+   * @param flagged    Flagged samples are appended here
+   * @return std::size_t Number of samples flagged over the whole batch
+   */
+  std::size_t update_batch(const int* timestamps, const double* values, std::size_t num_frames,
+                           std::vector<AnomalyEvent>& flagged);
+
+  /**
+   * @brief Score of each stream from the last update (0 while a stream has too little history)
+   *
+   * @return const std::vector<double>&
+   */
+  const std::vector<double>& last_scores() const { return scores_; }
+
+  std::size_t num_streams() const { return num_streams_; }
+  std::size_t history_size() const { return filled_; }
+
+ private:
+  void score_zscore(const double* values);
+  void score_mad(const double* values);
+  void push_history(const double* values);
+
+  std::size_t   num_streams_;
+  AnomalyConfig config_;
+
+  std::vector<double>       history_;     // [window slot][stream] ring buffer
+  std::vector<double>       sum_;         // Running sum per stream (z-score mode)
+  std::vector<double>       sum_sq_;      // Running sum of squares per stream (z-score mode)
+  std::vector<double>       scores_;      // Score per stream for the last update
+  std::vector<std::uint8_t> flags_;       // 1 if stream was flagged in the last update
+  std::vector<double>       scratch_;     // Window copy used for median/MAD
+  std::vector<double>       thresholds_;  // Flag threshold by number of history samples, 0..window
+
+  std::size_t head_{0};    // Next ring slot to overwrite
+  std::size_t filled_{0};  // Number of valid slots in the ring
+};
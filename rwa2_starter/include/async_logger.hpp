@@ -0,0 +1,255 @@
+/**
+ * @file    async_logger.hpp
+ * @author  Chris Collins
+ * @brief   Asynchronous binary logger: the processing thread appends a format ID and raw arguments to its own
+ *          lock-free ring, a background thread formats the records and writes them to the output stream
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Record layout in a ring (64-bit words):
+ *   header   format ID (low 32 bits) | record words including the header (high 32 bits)
+ *   args     per argument: tag word (type in the low 8 bits, length above), then the payload
+ *            int / double: 1 word, text: bytes padded to whole words, doubles: one word per value
+ * Records never wrap; a padding record fills the end of the ring instead.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t log_ring_bytes{64 * 1024};  // Per-thread ring size
+constexpr std::size_t log_max_categories{8};      // Sampling categories per logger
+
+using LogFormatId = std::uint32_t;
+
+/**
+ * @brief Array of doubles logged by value, printed comma separated
+ *
+ */
+struct LogSpan {
+  const double* data;
+  std::size_t   count;
+};
+
+namespace log_detail {
+enum ArgType : std::uint64_t { arg_int = 0, arg_double, arg_text, arg_doubles };
+
+constexpr std::uint32_t pad_format{0xFFFFFFFF};  // Filler at the end of the ring
+
+constexpr std::size_t   words_for(std::size_t bytes) { return (bytes + 7) / 8; }
+constexpr std::uint64_t arg_tag(ArgType type, std::uint64_t length) { return type | (length << 8); }
+constexpr std::uint64_t record_header(std::uint32_t format, std::size_t words) {
+  return format | (static_cast<std::uint64_t>(words) << 32);
+}
+
+// Words one encoded argument occupies (tag + payload)
+template <typename T>
+std::size_t arg_words(const T&) {
+  static_assert(std::is_arithmetic<T>::value, "log arguments are numbers, strings or LogSpan");
+  return 2;
+}
+inline std::size_t arg_words(const char* text) { return 1 + words_for(std::strlen(text)); }
+inline std::size_t arg_words(const std::string& text) { return 1 + words_for(text.size()); }
+inline std::size_t arg_words(const LogSpan& span) { return 1 + span.count; }
+
+inline void write_text(std::uint64_t*& out, const char* text, std::size_t length) {
+  *out++ = arg_tag(arg_text, length);
+  if (length % 8 != 0) { out[length / 8] = 0; }  // Zero the last, partial word (there is none at a multiple of 8)
+  std::memcpy(out, text, length);
+  out += words_for(length);
+}
+
+template <typename T>
+void write_arg(std::uint64_t*& out, const T& value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    const double payload = static_cast<double>(value);
+    *out++               = arg_tag(arg_double, 0);
+    std::memcpy(out++, &payload, sizeof(payload));
+  } else {
+    const auto payload = static_cast<std::int64_t>(value);
+    *out++             = arg_tag(arg_int, 0);
+    std::memcpy(out++, &payload, sizeof(payload));
+  }
+}
+inline void write_arg(std::uint64_t*& out, const char* text) { write_text(out, text, std::strlen(text)); }
+inline void write_arg(std::uint64_t*& out, const std::string& text) { write_text(out, text.data(), text.size()); }
+inline void write_arg(std::uint64_t*& out, const LogSpan& span) {
+  *out++ = arg_tag(arg_doubles, span.count);
+  std::memcpy(out, span.data, span.count * sizeof(double));
+  out += span.count;
+}
+
+/**
+ * @brief Single-producer / single-consumer ring of 64-bit words. The producer is the owning thread, the consumer
+ *        is the logger's background thread.
+ *
+ */
+class LogRing {
+ public:
+  explicit LogRing(std::size_t words);
+
+  /**
+   * @brief Space for a record of words, contiguous in the ring. Yields while the ring is full.
+   *
+   * @param words
+   * @return std::uint64_t* Where the record is written; published by commit()
+   * @throws std::length_error if the record is larger than half the ring
+   */
+  std::uint64_t* reserve(std::size_t words) {
+    std::size_t       position = static_cast<std::size_t>(pending_) & mask_;
+    const std::size_t padding  = position + words > capacity_ ? capacity_ - position : 0;
+    if (capacity_ - static_cast<std::size_t>(pending_ - cached_tail_) < padding + words) {
+      wait_for_space(padding + words);
+    }
+    if (padding != 0) {
+      data_[position] = record_header(pad_format, padding);
+      pending_ += padding;
+      position = 0;
+    }
+    return &data_[position];
+  }
+
+  void commit(std::size_t words) {
+    pending_ += words;
+    head_.store(pending_, std::memory_order_release);
+  }
+
+  // Consumer side
+  std::uint64_t        head() const { return head_.load(std::memory_order_acquire); }
+  std::uint64_t        tail() const { return tail_.load(std::memory_order_acquire); }
+  void                 release(std::uint64_t tail) { tail_.store(tail, std::memory_order_release); }
+  const std::uint64_t* at(std::uint64_t position) const { return &data_[static_cast<std::size_t>(position) & mask_]; }
+
+  std::uint64_t stalls() const { return stalls_.load(std::memory_order_relaxed); }
+
+ private:
+  void wait_for_space(std::size_t words);
+
+  std::size_t                      capacity_;
+  std::size_t                      mask_;
+  std::unique_ptr<std::uint64_t[]> data_;
+  std::uint64_t                    pending_{0};      // Producer: head including reserved padding
+  std::uint64_t                    cached_tail_{0};  // Producer: last tail seen
+  std::atomic<std::uint64_t>       stalls_{0};       // Times the producer found the ring full
+
+  alignas(64) std::atomic<std::uint64_t> head_{0};  // Written by the producer
+  alignas(64) std::atomic<std::uint64_t> tail_{0};  // Written by the consumer
+};
+}  // namespace log_detail
+
+/**
+ * @brief Asynchronous logger with printf-like formats, per-thread rings and per-category sampling
+ *
+ * Formats are registered once with define(); "{}" prints an argument, "{.N}" prints a number with N decimals.
+ * Records from one thread are written in order; records from different threads are interleaved per drain pass.
+ */
+class AsyncLogger {
+ public:
+  /**
+   * @brief Start the background writer
+   *
+   * @param out        Destination stream, written only by the background thread until the logger is destroyed
+   * @param ring_bytes Ring size per logging thread
+   */
+  explicit AsyncLogger(std::ostream& out, std::size_t ring_bytes = log_ring_bytes);
+  ~AsyncLogger();
+
+  AsyncLogger(const AsyncLogger&)            = delete;
+  AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+  /**
+   * @brief Register a format
+   *
+   * @param pattern Text with "{}" / "{.N}" placeholders
+   * @return LogFormatId
+   * @throws std::invalid_argument on an unterminated or malformed placeholder
+   */
+  LogFormatId define(const std::string& pattern);
+
+  /**
+   * @brief Log every Nth sequence number of a category (1 = everything, 0 = nothing)
+   *
+   * @param category
+   * @param every_n
+   */
+  void set_sample_every(std::size_t category, std::uint32_t every_n);
+
+  bool sampled(std::size_t category, std::uint64_t sequence) const {
+    const std::uint32_t every_n = sample_every_[category].load(std::memory_order_relaxed);
+    return every_n != 0 && sequence % every_n == 0;
+  }
+
+  /**
+   * @brief Append a record to the calling thread's ring. Arguments are copied; nothing is formatted here.
+   *
+   * @tparam Args Arithmetic types, const char*, std::string or LogSpan
+   * @param format ID from define()
+   * @param args
+   */
+  template <typename... Args>
+  void log(LogFormatId format, const Args&... args) {
+    const std::size_t     words = 1 + (std::size_t{0} + ... + log_detail::arg_words(args));
+    log_detail::LogRing& ring  = thread_ring();
+    std::uint64_t*        out   = ring.reserve(words);
+    *out++                      = log_detail::record_header(format, words);
+    (log_detail::write_arg(out, args), ...);
+    ring.commit(words);
+  }
+
+  /**
+   * @brief Block until every record logged before the call has been written to the stream
+   *
+   */
+  void flush();
+
+  std::uint64_t stalls() const;  // Times any producer waited on a full ring
+
+ private:
+  struct Segment {
+    std::string literal;     // Text before the placeholder
+    int         precision;   // Decimals for numbers, -1 for the default
+    bool        placeholder;
+  };
+
+  log_detail::LogRing& thread_ring() {
+    thread_local std::pair<std::uint64_t, log_detail::LogRing*> cached{0, nullptr};  // Logger ID, ring
+    if (cached.first != id_) { cached = {id_, &register_thread()}; }
+    return *cached.second;
+  }
+
+  log_detail::LogRing& register_thread();
+  void                 run();
+  bool                 drain();
+  void                 format(const std::vector<Segment>& segments, const std::uint64_t* args, std::size_t words);
+
+  std::ostream&                                             out_;
+  std::size_t                                               ring_words_;
+  std::uint64_t                                             id_;
+  std::array<std::atomic<std::uint32_t>, log_max_categories> sample_every_;
+
+  mutable std::mutex                                    mutex_;  // Guards everything below
+  std::condition_variable                               wake_;
+  std::condition_variable                               drained_;
+  std::vector<std::pair<std::thread::id, std::unique_ptr<log_detail::LogRing>>> rings_;
+  std::vector<std::vector<Segment>>                     formats_;
+  bool                                                  flush_requested_{false};
+  bool                                                  stop_{false};
+
+  std::string text_;  // Background thread: formatted output of one drain pass
+  std::thread writer_;
+};
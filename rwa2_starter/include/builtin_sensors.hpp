@@ -0,0 +1,59 @@
+/**
+ * @file    builtin_sensors.hpp
+ * @author  Chris Collins
+ * @brief   LIDAR, Camera and IMU as sensor plugins (sensor_plugin.hpp) and the suite every frame source carries
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "frame_processing.hpp"
+#include "sensor_plugin.hpp"
+#include <cstddef>
+
+/**
+ * @brief LIDAR scan held outside the plugin (TimestampData vector, shared-memory slot or filtered scan)
+ *
+ */
+struct LidarScan {
+  const double* readings;  // Distance readings [m] (not owned)
+  std::size_t   count;
+};
+
+struct LidarSensor {
+  using Reading = LidarScan;
+  using Result  = LidarResult;
+  static constexpr const char* name{"LIDAR"};
+
+  static Result process(int timestamp, const Reading& scan) { return process_lidar(timestamp, scan.readings, scan.count); }
+  static bool   valid(const Result& result) { return result.valid; }
+};
+
+struct CameraSensor {
+  using Reading = CameraData;
+  using Result  = CameraResult;
+  static constexpr const char* name{"Camera"};
+
+  static Result process(int timestamp, const Reading& rgb) { return process_camera(timestamp, rgb); }
+  static bool   valid(const Result& result) { return result.valid; }
+};
+
+struct ImuSensor {
+  using Reading = ImuData;
+  using Result  = ImuResult;
+  static constexpr const char* name{"IMU"};
+
+  static Result process(int timestamp, const Reading& rpy) { return process_imu(timestamp, rpy); }
+  static bool   valid(const Result& result) { return result.valid; }
+};
+
+/**
+ * @brief Sensors carried by every frame source (TimestampData, SharedFrame and the wire/recording codec) and
+ *        combined into a ProcessedFrame
+ *
+ */
+using BuiltinSensors = SensorSuite<LidarSensor, CameraSensor, ImuSensor>;
@@ -0,0 +1,198 @@
+/**
+ * @file    fixed_matrix.hpp
+ * @author  Chris Collins
+ * @brief   Compile-time-dimensioned matrix and vector templates for small estimation problems. Storage is an inline
+ *          array, loop bounds are constants the compiler fully unrolls, and nothing allocates.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief R x C matrix stored row-major in place
+ *
+ * @tparam R Rows
+ * @tparam C Columns
+ * @tparam T Scalar type
+ */
+template <std::size_t R, std::size_t C, typename T = double>
+struct Mat {
+  static_assert(R > 0 && C > 0, "matrix dimensions must be positive");
+  static constexpr std::size_t rows{R};
+  static constexpr std::size_t cols{C};
+
+  std::array<T, R * C> data{};  // Zero-initialized
+
+  constexpr T&       operator()(std::size_t r, std::size_t c) { return data[r * C + c]; }
+  constexpr const T& operator()(std::size_t r, std::size_t c) const { return data[r * C + c]; }
+
+  // Element access for column vectors
+  constexpr T&       operator[](std::size_t i) { return data[i]; }
+  constexpr const T& operator[](std::size_t i) const { return data[i]; }
+
+  static constexpr Mat zeros() { return Mat{}; }
+
+  static constexpr Mat identity() {
+    static_assert(R == C, "identity requires a square matrix");
+    Mat m{};
+    for (std::size_t i{0}; i < R; ++i) { m(i, i) = T{1}; }
+    return m;
+  }
+
+  /**
+   * @brief Diagonal matrix from its diagonal entries
+   *
+   */
+  template <typename... Values>
+  static constexpr Mat diagonal(Values... values) {
+    static_assert(R == C && sizeof...(Values) == R, "diagonal requires a square matrix and R values");
+    Mat         m{};
+    std::size_t i{0};
+    ((m(i, i) = static_cast<T>(values), ++i), ...);
+    return m;
+  }
+
+  constexpr Mat& operator+=(const Mat& other) {
+    for (std::size_t i{0}; i < R * C; ++i) { data[i] += other.data[i]; }
+    return *this;
+  }
+  constexpr Mat& operator-=(const Mat& other) {
+    for (std::size_t i{0}; i < R * C; ++i) { data[i] -= other.data[i]; }
+    return *this;
+  }
+  constexpr Mat& operator*=(T scale) {
+    for (std::size_t i{0}; i < R * C; ++i) { data[i] *= scale; }
+    return *this;
+  }
+};
+
+template <std::size_t N, typename T = double>
+using Vec = Mat<N, 1, T>;
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr Mat<R, C, T> operator+(Mat<R, C, T> a, const Mat<R, C, T>& b) {
+  return a += b;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr Mat<R, C, T> operator-(Mat<R, C, T> a, const Mat<R, C, T>& b) {
+  return a -= b;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr Mat<R, C, T> operator*(Mat<R, C, T> a, T scale) {
+  return a *= scale;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr Mat<R, C, T> operator*(T scale, Mat<R, C, T> a) {
+  return a *= scale;
+}
+
+/**
+ * @brief Matrix product (R x K) * (K x C)
+ *
+ */
+template <std::size_t R, std::size_t K, std::size_t C, typename T>
+constexpr Mat<R, C, T> operator*(const Mat<R, K, T>& a, const Mat<K, C, T>& b) {
+  Mat<R, C, T> out{};
+  for (std::size_t r{0}; r < R; ++r) {
+    for (std::size_t k{0}; k < K; ++k) {
+      const T a_rk = a(r, k);
+      for (std::size_t c{0}; c < C; ++c) { out(r, c) += a_rk * b(k, c); }
+    }
+  }
+  return out;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr Mat<C, R, T> transpose(const Mat<R, C, T>& m) {
+  Mat<C, R, T> out{};
+  for (std::size_t r{0}; r < R; ++r) {
+    for (std::size_t c{0}; c < C; ++c) { out(c, r) = m(r, c); }
+  }
+  return out;
+}
+
+/**
+ * @brief Inverse of a small square matrix: closed form up to 3x3, Gauss-Jordan with partial pivoting above
+ *
+ * @param m       Matrix to invert
+ * @param inverse Output, untouched if m is singular
+ * @return false if m is singular (|pivot| or |determinant| below a tiny threshold)
+ */
+template <std::size_t N, typename T>
+bool invert(const Mat<N, N, T>& m, Mat<N, N, T>& inverse) {
+  constexpr T tiny = static_cast<T>(1e-12);
+  if constexpr (N == 1) {
+    if (std::abs(m(0, 0)) < tiny) { return false; }
+    inverse(0, 0) = T{1} / m(0, 0);
+    return true;
+  } else if constexpr (N == 2) {
+    const T det = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+    if (std::abs(det) < tiny) { return false; }
+    const T inv_det = T{1} / det;
+    inverse(0, 0)   = m(1, 1) * inv_det;
+    inverse(0, 1)   = -m(0, 1) * inv_det;
+    inverse(1, 0)   = -m(1, 0) * inv_det;
+    inverse(1, 1)   = m(0, 0) * inv_det;
+    return true;
+  } else if constexpr (N == 3) {
+    const T c00 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+    const T c01 = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+    const T c02 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+    const T det = m(0, 0) * c00 + m(0, 1) * c01 + m(0, 2) * c02;
+    if (std::abs(det) < tiny) { return false; }
+    const T inv_det = T{1} / det;
+    inverse(0, 0)   = c00 * inv_det;
+    inverse(0, 1)   = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * inv_det;
+    inverse(0, 2)   = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * inv_det;
+    inverse(1, 0)   = c01 * inv_det;
+    inverse(1, 1)   = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * inv_det;
+    inverse(1, 2)   = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * inv_det;
+    inverse(2, 0)   = c02 * inv_det;
+    inverse(2, 1)   = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * inv_det;
+    inverse(2, 2)   = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * inv_det;
+    return true;
+  } else {
+    Mat<N, N, T> a   = m;
+    Mat<N, N, T> inv = Mat<N, N, T>::identity();
+    for (std::size_t col{0}; col < N; ++col) {
+      std::size_t pivot{col};
+      for (std::size_t r{col + 1}; r < N; ++r) {
+        if (std::abs(a(r, col)) > std::abs(a(pivot, col))) { pivot = r; }
+      }
+      if (std::abs(a(pivot, col)) < tiny) { return false; }
+      if (pivot != col) {
+        for (std::size_t c{0}; c < N; ++c) {
+          std::swap(a(pivot, c), a(col, c));
+          std::swap(inv(pivot, c), inv(col, c));
+        }
+      }
+      const T scale = T{1} / a(col, col);
+      for (std::size_t c{0}; c < N; ++c) {
+        a(col, c) *= scale;
+        inv(col, c) *= scale;
+      }
+      for (std::size_t r{0}; r < N; ++r) {
+        if (r == col) { continue; }
+        const T factor = a(r, col);
+        for (std::size_t c{0}; c < N; ++c) {
+          a(r, c) -= factor * a(col, c);
+          inv(r, c) -= factor * inv(col, c);
+        }
+      }
+    }
+    inverse = inv;
+    return true;
+  }
+}
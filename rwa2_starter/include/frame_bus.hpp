@@ -0,0 +1,110 @@
+/**
+ * @file    frame_bus.hpp
+ * @author  Chris Collins
+ * @brief   Statically dispatched event bus for raw and processed sensor frames. Subscribers are registered as
+ *          template parameters, so every publish() expands to direct (inlinable) calls with no virtual functions
+ *          or std::function.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "frame_processing.hpp"
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace frame_bus_detail {
+/**
+ * @brief True if Handler has a member on(const Event&) callable with an Event
+ *
+ */
+template <typename Handler, typename Event, typename = void>
+struct handles : std::false_type {};
+
+template <typename Handler, typename Event>
+struct handles<Handler, Event, std::void_t<decltype(std::declval<Handler&>().on(std::declval<const Event&>()))>>
+    : std::true_type {};
+}  // namespace frame_bus_detail
+
+/**
+ * @brief Event bus over a fixed set of subscribers
+ *
+ * A subscriber is any class with one or more `void on(const Event&)` members. Events a subscriber has no `on()`
+ * for are skipped at compile time, so a subscriber only pays for the events it handles and an unused event type
+ * compiles to nothing. Subscribers are called in the order they appear in the parameter pack.
+ *
+ * Events published by the rwa2 loop:
+ *  - TimestampData  (raw frame, before processing)
+ *  - LidarResult, CameraResult, ImuResult (per sensor type)
+ *  - ProcessedFrame (all sensors for one timestamp)
+ *  - Result of every extra sensor plugin (sensor_plugin.hpp)
+ *  - FrameEnd, RunComplete
+ *
+ * @tparam Subscribers Subscriber types, stored by value
+ */
+template <typename... Subscribers>
+class FrameBus {
+ public:
+  FrameBus() = default;
+  explicit FrameBus(Subscribers... subscribers) : subscribers_{std::move(subscribers)...} {}
+
+  /**
+   * @brief Deliver an event to every subscriber that handles it
+   *
+   * @tparam Event
+   * @param event
+   */
+  template <typename Event>
+  void publish(const Event& event) {
+    std::apply([&event](auto&... subscriber) { (deliver(subscriber, event), ...); }, subscribers_);
+  }
+
+  /**
+   * @brief Publish the per-sensor results of a processed frame, then the frame itself
+   *
+   * @param frame
+   */
+  void publish_processed(const ProcessedFrame& frame) {
+    publish(frame.lidar);
+    publish(frame.camera);
+    publish(frame.imu);
+    publish(frame);
+  }
+
+  /**
+   * @brief Access a subscriber by type (e.g. to read its counters after the run)
+   *
+   * @tparam Subscriber
+   * @return Subscriber&
+   */
+  template <typename Subscriber>
+  Subscriber& get() { return std::get<Subscriber>(subscribers_); }
+
+  template <typename Subscriber>
+  const Subscriber& get() const { return std::get<Subscriber>(subscribers_); }
+
+ private:
+  template <typename Subscriber, typename Event>
+  static void deliver(Subscriber& subscriber, const Event& event) {
+    if constexpr (frame_bus_detail::handles<Subscriber, Event>::value) { subscriber.on(event); }
+  }
+
+  std::tuple<Subscribers...> subscribers_;
+};
+
+/**
+ * @brief Build a FrameBus, deducing the subscriber types
+ *
+ * @tparam Subscribers
+ * @param subscribers
+ * @return FrameBus<Subscribers...>
+ */
+template <typename... Subscribers>
+FrameBus<Subscribers...> make_frame_bus(Subscribers... subscribers) {
+  return FrameBus<Subscribers...>{std::move(subscribers)...};
+}
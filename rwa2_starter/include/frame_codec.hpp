@@ -0,0 +1,68 @@
+/**
+ * @file    frame_codec.hpp
+ * @author  Chris Collins
+ * @brief   Length-prefixed binary encoding of sensor frames, shared by the socket ingest path and recordings
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Encoded frame (host byte order):
+ *   uint32 payload_bytes
+ *   int32  timestamp
+ *   int32  lidar_count
+ *   uint64 acquired_ns
+ *   double lidar[lidar_count]
+ *   int32  rgb[3]
+ *   double rpy[3]
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include "shm_transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr std::size_t frame_header_bytes{sizeof(std::uint32_t)};
+constexpr std::size_t frame_max_payload_bytes{2 * sizeof(std::int32_t) + sizeof(std::uint64_t) +
+                                              shm_max_lidar_readings * sizeof(double) + 3 * sizeof(std::int32_t) +
+                                              3 * sizeof(double)};
+
+/**
+ * @brief Number of bytes encode_frame() writes for a frame with lidar_count readings
+ *
+ * @param lidar_count
+ * @return std::size_t
+ */
+inline std::size_t encoded_frame_bytes(std::size_t lidar_count) {
+  return frame_header_bytes + 2 * sizeof(std::int32_t) + sizeof(std::uint64_t) + lidar_count * sizeof(double) +
+         3 * sizeof(std::int32_t) + 3 * sizeof(double);
+}
+
+/**
+ * @brief Append one length-prefixed frame to out
+ *
+ * @param data Frame to encode (LIDAR readings beyond shm_max_lidar_readings are dropped)
+ * @param out  Destination buffer
+ */
+void encode_frame(const TimestampData& data, std::vector<unsigned char>& out);
+
+/**
+ * @brief Append one length-prefixed fixed-layout frame to out
+ *
+ * @param frame Frame to encode
+ * @param out   Destination buffer
+ */
+void encode_frame(const SharedFrame& frame, std::vector<unsigned char>& out);
+
+/**
+ * @brief Decode one payload (without its length prefix) into a fixed-layout frame
+ *
+ * @param payload Payload bytes
+ * @param bytes   Payload length
+ * @param out     Destination frame
+ * @return true   Payload was well formed
+ */
+bool decode_frame(const unsigned char* payload, std::size_t bytes, SharedFrame& out);
@@ -0,0 +1,266 @@
+/**
+ * @file    frame_consumers.hpp
+ * @author  Chris Collins
+ * @brief   Subscribers for the rwa2 FrameBus: per-timestamp console report, summary statistics, anomaly monitor,
+ *          recorder, per-frame result indexer, voxel-downsampled scan maps and scan-matching odometry
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "anomaly_detector.hpp"
+#include "async_logger.hpp"
+#include "frame_processing.hpp"
+#include "frame_query.hpp"
+#include "frame_timing.hpp"
+#include "health_monitor.hpp"
+#include "pose_ekf.hpp"
+#include "recording.hpp"
+#include "scan_filter.hpp"
+#include "scan_matcher.hpp"
+#include "voxel_grid.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief AsyncLogger categories for per-frame output, sampled independently (e.g. every Nth frame report)
+ *
+ */
+enum LogCategory : std::size_t { log_frame_report = 0, log_anomalies, log_health };
+
+/**
+ * @brief Logs each timestamp's sensor readings, classifications and status. Must be the first subscriber: it
+ *        flushes the logger when the run completes so the summaries print after the last frame.
+ *
+ */
+class FrameReport {
+ public:
+  explicit FrameReport(AsyncLogger& log);
+
+  void on(const ProcessedFrame& frame);
+  void on(const FrameEnd& end);
+  void on(const RunComplete& run);
+
+ private:
+  AsyncLogger& log_;
+  LogFormatId  frame_format_;
+  LogFormatId  end_format_;
+};
+
+/**
+ * @brief Accumulates validity counts and operational statistics, prints the summary at the end of the run
+ *
+ */
+class SensorStatistics {
+ public:
+  SensorStatistics();
+
+  void on(const LidarResult& lidar);
+  void on(const CameraResult& camera);
+  void on(const ImuResult& imu);
+  void on(const ScanFilterResult& filter);
+  void on(const RunComplete& run);
+
+  // Quality tracking variables
+  std::unordered_map<std::string, int> valid_readings;
+  std::unordered_map<std::string, int> total_readings;
+
+  // Variables for calculating summary statistics across timestamps
+  double total_lidar_avg_distance{0.0};     // Total of average LIDAR distances
+  double total_camera_avg_brightness{0.0};  // Total of average Camera brightness
+  double total_imu_rotation{0.0};           // Total of average IMU rotation
+  int    total_obstacles_detected{0};       // Total obstacles detected
+  int    lidar_beams_repaired{0};           // LIDAR beams replaced by the scan filter
+  int    lidar_scans_repaired{0};           // LIDAR scans with at least one repaired beam
+  int    day_mode_count{0};                 // Count of day mode detections
+  int    night_mode_count{0};               // Count of night mode detections
+  int    stable_imu_count{0};               // Count of stable IMU detections
+  int    unstable_imu_count{0};             // Count of unstable IMU detections
+};
+
+/**
+ * @brief Feeds processed values to an AnomalyDetector, logs flagged channels per frame and prints the flagged frame
+ *        list
+ *
+ */
+class AnomalyMonitor {
+ public:
+  AnomalyMonitor(const AnomalyConfig& config, AsyncLogger& log);
+
+  void on(const ProcessedFrame& frame);
+  void on(const RunComplete& run);
+
+  const std::vector<AnomalyEvent>& events() const { return events_; }
+
+ private:
+  AnomalyDetector           detector_;
+  std::vector<AnomalyEvent> events_;  // Flagged frames across all timestamps
+  AsyncLogger&              log_;
+  LogFormatId               begin_format_;
+  LogFormatId               event_format_;
+  LogFormatId               end_format_;
+};
+
+/**
+ * @brief Writes every raw frame to a block-structured recording once open() is called, otherwise does nothing
+ *
+ */
+class FrameRecorder {
+ public:
+  /**
+   * @brief Start recording to path
+   *
+   * @param path
+   * @throws std::runtime_error if the recording cannot be created
+   */
+  void open(const std::string& path);
+
+  void on(const TimestampData& data);
+  void on(const SharedFrame& frame);
+  void on(const RunComplete& run);
+
+ private:
+  std::unique_ptr<RecordingWriter> writer_;  // Null when recording is disabled
+  std::string                      path_;
+};
+
+/**
+ * @brief Stores every processed frame in a FrameResultTable and saves it at the end of the run once open() is called
+ *
+ */
+class ResultIndexer {
+ public:
+  /**
+   * @brief Enable indexing; the table is written to path when the run completes
+   *
+   * @param path
+   */
+  void open(const std::string& path) { path_ = path; }
+
+  void on(const ProcessedFrame& frame);
+  void on(const RunComplete& run);
+
+ private:
+  FrameResultTable table_{};
+  std::string      path_{};  // Empty when indexing is disabled
+};
+
+/**
+ * @brief Accumulates LIDAR point clouds and downsamples every voxel_accumulate_frames scans into a map
+ *
+ */
+class ScanDownsampler {
+ public:
+  /**
+   * @brief Create the downsampler
+   *
+   * @param cell_size  Voxel edge length [m]
+   * @param partitions Spatial partitions / threads used by the voxel grid
+   * @param frames     Scans accumulated per map
+   */
+  explicit ScanDownsampler(double cell_size = voxel_cell_size, std::size_t partitions = 1,
+                           std::size_t frames = voxel_accumulate_frames);
+
+  void on(const PointCloud& scan);
+  void on(const RunComplete& run);
+
+  /**
+   * @brief Most recent downsampled map (empty until the first map is complete)
+   *
+   * @return const PointCloud&
+   */
+  const PointCloud& map() const { return map_; }
+
+ private:
+  void flush();
+
+  VoxelGrid   grid_;
+  PointCloud  map_{};
+  std::size_t frames_per_map_;
+  std::size_t frames_in_grid_{0};
+  std::size_t maps_{0};        // Maps produced
+  std::size_t points_in_{0};   // Points accumulated across all maps
+  std::size_t points_out_{0};  // Centroids produced across all maps
+};
+
+/**
+ * @brief Matches each LIDAR scan against the previous one with ICP and integrates the relative motion of converged
+ *        matches into a pose.
+ *        An EKF fuses the scan-matching motion of converged, well-supported matches with IMU yaw into a second,
+ *        filtered pose estimate.
+ *
+ */
+class ScanOdometry {
+ public:
+  explicit ScanOdometry(const IcpConfig& config = IcpConfig{}, const EkfConfig& ekf = EkfConfig::defaults());
+
+  void on(const PointCloud& scan);
+  void on(const ImuResult& imu);
+  void on(const RunComplete& run);
+
+  const Pose2D&  pose() const { return pose_; }
+  const PoseEkf& filter() const { return ekf_; }
+
+ private:
+  ScanMatcher matcher_;
+  PoseEkf     ekf_;
+  Pose2D      pose_{};              // Pose of the latest scan in the first scan's frame
+  std::size_t matches_{0};
+  std::size_t converged_{0};
+  std::size_t iterations_{0};       // Total ICP iterations across matches
+  double      match_seconds_{0.0};  // Total time spent matching
+  double      max_match_seconds_{0.0};
+};
+
+/**
+ * @brief Tracks rolling LIDAR, Camera and IMU validity rates, logs alerts as they are raised or cleared and prints
+ *        the rates per horizon at the end of the run
+ *
+ */
+class SensorHealth {
+ public:
+  enum Sensor : std::size_t { lidar_sensor = 0, camera_sensor, imu_sensor, sensor_count };
+
+  explicit SensorHealth(AsyncLogger& log, const HealthConfig& config = HealthConfig{});
+
+  void on(const LidarResult& lidar);
+  void on(const CameraResult& camera);
+  void on(const ImuResult& imu);
+  void on(const ProcessedFrame& frame);
+  void on(const RunComplete& run);
+
+  const HealthMonitor& monitor() const { return monitor_; }
+
+ private:
+  void record(Sensor sensor, int timestamp, bool valid);
+
+  HealthMonitor            monitor_;
+  std::vector<HealthEvent> pending_{};  // Transitions of the current frame, printed after its report
+  std::size_t              alerts_{0};  // Alerts raised during the run
+  AsyncLogger&             log_;
+  LogFormatId              event_format_;
+};
+
+/**
+ * @brief Records per-stage and end-to-end frame latency and prints percentiles at the end of the run
+ *
+ */
+class LatencyTracker {
+ public:
+  void on(const FrameTiming& timing);
+  void on(const RunComplete& run);
+
+  const LatencyHistogram& end_to_end() const { return end_to_end_; }
+
+ private:
+  LatencyHistogram end_to_end_{};  // Acquisition to report done (frames with a known acquisition time)
+  LatencyHistogram transport_{};   // Acquisition to ingest
+  LatencyHistogram processing_{};  // Ingest to sensor processing complete
+  LatencyHistogram reporting_{};   // Processing complete to report done
+};
@@ -0,0 +1,148 @@
+/**
+ * @file    frame_processing.hpp
+ * @author  Chris Collins
+ * @brief   Per-timestamp sensor processing (validity checks, quality assessment, classification) and the
+ *          result structs published to frame subscribers
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "image_kernels.hpp"
+#include "sensor_types.hpp"
+#include <cstddef>
+
+/**
+ * @brief Processed LIDAR results for one timestamp
+ *
+ */
+struct LidarResult {
+  int           timestamp;
+  const double* readings;      // Raw distance readings (not owned)
+  std::size_t   count;         // Number of raw readings
+  double        avg_distance;  // Average distance [m]
+  int           obstacles;     // Readings <= obstacle_threshold
+  bool          valid;         // False if any reading < lidar_min_valid (STATUS: POOR)
+};
+
+/**
+ * @brief Processed Camera results for one timestamp
+ *
+ */
+struct CameraResult {
+  int    timestamp;
+  int    r, g, b;     // Raw RGB values
+  double brightness;  // Average of R, G, B
+  bool   night;       // brightness <= day_night_threshold
+  bool   valid;       // brightness >= brightness_threshold
+};
+
+/**
+ * @brief Processed IMU results for one timestamp
+ *
+ */
+struct ImuResult {
+  int    timestamp;
+  double roll, pitch, yaw;  // Raw orientation [deg]
+  double total_rotation;    // Magnitude of (roll, pitch, yaw) [deg]
+  bool   stable;            // All |angles| < imu_stability_threshold
+  bool   valid;             // All angles strictly within (imu_min_rotation, imu_max_rotation)
+};
+
+/**
+ * @brief All processed results for one timestamp
+ *
+ */
+struct ProcessedFrame {
+  int          timestamp;
+  LidarResult  lidar;
+  CameraResult camera;
+  ImuResult    imu;
+};
+
+/**
+ * @brief Marks the end of one timestamp, published after its ProcessedFrame
+ *
+ */
+struct FrameEnd {
+  int timestamp;
+};
+
+/**
+ * @brief Marks the end of a run, published once after the last frame
+ *
+ */
+struct RunComplete {
+  int frames_processed;
+};
+
+/**
+ * @brief Process LIDAR readings: average distance, obstacle count and validity
+ *
+ * @param timestamp Timestamp ID
+ * @param readings  Distance readings [m]
+ * @param count     Number of readings
+ * @return LidarResult
+ */
+LidarResult process_lidar(int timestamp, const double* readings, std::size_t count);
+
+/**
+ * @brief Process Camera RGB reading: brightness, DAY/NIGHT mode and validity
+ *
+ * @param timestamp Timestamp ID
+ * @param camera    RGB values
+ * @return CameraResult
+ */
+CameraResult process_camera(int timestamp, const CameraData& camera);
+
+/**
+ * @brief Process a camera image from its pyramid: mean RGB of a reduced level drives brightness, DAY/NIGHT mode and
+ *        validity exactly as for a single RGB reading, at a fraction of the full-resolution cost
+ *
+ * @param timestamp Timestamp ID
+ * @param pyramid   Pyramid built over a 3-channel RGB image
+ * @param level     Pyramid level to classify (clamped to the smallest level built)
+ * @return CameraResult
+ * @throws std::invalid_argument if the image is not 3-channel
+ */
+CameraResult process_camera(int timestamp, const ImagePyramid& pyramid,
+                            std::size_t level = camera_brightness_level);
+
+/**
+ * @brief Process IMU reading: total rotation, stability and validity
+ *
+ * @param timestamp Timestamp ID
+ * @param imu       Roll, Pitch, Yaw [deg]
+ * @return ImuResult
+ */
+ImuResult process_imu(int timestamp, const ImuData& imu);
+
+/**
+ * @brief Process every sensor of one timestamp
+ *
+ * Takes the LIDAR readings as a pointer/count pair so frames held outside a TimestampData can be processed in place.
+ *
+ * @param timestamp   Timestamp ID
+ * @param lidar       LIDAR distance readings [m]
+ * @param lidar_count Number of LIDAR readings
+ * @param camera      Camera RGB values
+ * @param imu         IMU Roll, Pitch, Yaw [deg]
+ * @return ProcessedFrame
+ */
+ProcessedFrame process_frame(int timestamp, const double* lidar, std::size_t lidar_count, const CameraData& camera,
+                             const ImuData& imu);
+
+/**
+ * @brief Process every sensor of one stored timestamp
+ *
+ * @param data Sensor readings for one timestamp
+ * @return ProcessedFrame
+ */
+inline ProcessedFrame process_frame(const TimestampData& data) {
+  return process_frame(data.timestamp, data.lidar_readings.data(), data.lidar_readings.size(), data.camera_readings,
+                       data.imu_readings);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file    frame_query.hpp
+ * @author  Chris Collins
+ * @brief   Query engine over stored per-frame results: roaring bitmap indexes for every status flag and
+ *          classification, columnar metric storage with vectorized predicate scans, and a small query language
+ *          for boolean combinations (e.g. "night lidar_poor obstacles>3")
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "frame_processing.hpp"
+#include "roaring_bitmap.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Indexed status flags and classifications. Each has a precomputed bitmap.
+ *
+ */
+enum FrameFlag : std::size_t {
+  flag_lidar_good = 0,
+  flag_lidar_poor,
+  flag_camera_good,
+  flag_camera_poor,
+  flag_day,
+  flag_night,
+  flag_imu_stable,
+  flag_imu_unstable,
+  flag_imu_good,
+  flag_imu_poor,
+  frame_flag_count
+};
+
+/**
+ * @brief Metric columns that can be scanned with a comparison predicate
+ *
+ */
+enum FrameColumn : std::size_t {
+  column_timestamp = 0,
+  column_lidar_avg,
+  column_obstacles,
+  column_brightness,
+  column_rotation,
+  frame_column_count
+};
+
+enum class CompareOp { Less, LessEqual, Greater, GreaterEqual, Equal, NotEqual };
+
+/**
+ * @brief Column-store of per-frame results with bitmap indexes. Row ID = order in which frames were appended.
+ *
+ */
+class FrameResultTable {
+ public:
+  /**
+   * @brief Append one processed frame (updates columns and flag bitmaps)
+   *
+   * @param frame
+   */
+  void append(const ProcessedFrame& frame);
+
+  std::size_t size() const { return timestamps_.size(); }
+
+  /**
+   * @brief Precomputed bitmap of rows with a flag set
+   *
+   * @param flag
+   * @return const RoaringBitmap&
+   */
+  const RoaringBitmap& flag(FrameFlag flag) const { return flags_[flag]; }
+
+  /**
+   * @brief Rows whose column value compares true against value (branch-free scan, 64 rows per output word)
+   *
+   * @param column
+   * @param op
+   * @param value
+   * @return RoaringBitmap
+   */
+  RoaringBitmap where(FrameColumn column, CompareOp op, double value) const;
+
+  /**
+   * @brief Rows of candidates whose column value compares true against value (one lookup per candidate row)
+   *
+   * @param column
+   * @param op
+   * @param value
+   * @param candidates
+   * @return RoaringBitmap
+   */
+  RoaringBitmap where(FrameColumn column, CompareOp op, double value, const RoaringBitmap& candidates) const;
+
+  /**
+   * @brief Every row in the table
+   *
+   * @return RoaringBitmap
+   */
+  RoaringBitmap all() const { return RoaringBitmap::range(static_cast<std::uint32_t>(size())); }
+
+  int   timestamp(std::uint32_t row) const { return timestamps_[row]; }
+  float value(FrameColumn column, std::uint32_t row) const;
+
+  /**
+   * @brief Write columns and flags to path
+   *
+   * @param path
+   * @throws std::runtime_error on I/O failure
+   */
+  void save(const std::string& path) const;
+
+  /**
+   * @brief Read a table written by save() and rebuild its bitmap indexes
+   *
+   * @param path
+   * @return FrameResultTable
+   * @throws std::runtime_error if the file is missing or malformed
+   */
+  static FrameResultTable load(const std::string& path);
+
+ private:
+  void append_row(int timestamp, float lidar_avg, float obstacles, float brightness, float rotation,
+                  std::uint16_t flag_bits);
+
+  std::vector<std::int32_t>                timestamps_;
+  std::array<std::vector<float>, 4>        metrics_;      // lidar_avg, obstacles, brightness, rotation
+  std::vector<std::uint16_t>               flag_bits_;    // Bit f set when FrameFlag f applies (kept for save())
+  std::array<RoaringBitmap, frame_flag_count> flags_;
+};
+
+/**
+ * @brief Parse and evaluate a query against a table
+ *
+ * Grammar: terms separated by spaces are ANDed, groups separated by "or" are ORed. A term is a flag name
+ * (lidar_good, lidar_poor, camera_good, camera_poor, day, night, stable, unstable, imu_good, imu_poor) optionally
+ * prefixed with '!', or a comparison "<column><op><value>" with column t, lidar_avg, obstacles, brightness,
+ * rotation and op <, <=, >, >=, ==, !=.
+ *
+ * Example: "night lidar_poor obstacles>3 or brightness<20"
+ *
+ * @param table
+ * @param query
+ * @return RoaringBitmap Matching row IDs
+ * @throws std::invalid_argument on an unknown term or a comparison value that is not a number
+ */
+RoaringBitmap run_query(const FrameResultTable& table, const std::string& query);
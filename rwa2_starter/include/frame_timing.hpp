@@ -0,0 +1,117 @@
+/**
+ * @file    frame_timing.hpp
+ * @author  Chris Collins
+ * @brief   Monotonic frame timestamps, cheap per-stage stamps and latency histograms for end-to-end frame latency
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Absolute times (frame acquisition, ingest) come from clock_gettime(CLOCK_MONOTONIC), which every process on the
+ * host shares. Stages within a frame are stamped with the CPU cycle counter (TSC on x86 when it is invariant,
+ * otherwise clock_gettime) relative to the ingest anchor, so calibration error only scales the short stage
+ * durations and never accumulates into the absolute times.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CLOCK_MONOTONIC time [ns]
+ *
+ */
+std::uint64_t monotonic_ns();
+
+/**
+ * @brief Cycle counter: TSC ticks when usable, otherwise monotonic_ns()
+ *
+ */
+std::uint64_t cycle_count();
+
+/**
+ * @brief Convert a cycle_count() difference to nanoseconds (calibrated once per process)
+ *
+ */
+std::uint64_t cycles_to_ns(std::uint64_t cycles);
+
+/**
+ * @brief Calibrate the cycle counter now instead of on first use (busy-waits about 5 ms, once per process)
+ *
+ */
+void calibrate_cycle_clock();
+
+/**
+ * @brief Name of the cycle counter in use ("tsc" or "clock_gettime")
+ *
+ */
+const char* cycle_clock_name();
+
+/**
+ * @brief Stage times of one frame, published after its FrameEnd
+ *
+ */
+struct FrameTiming {
+  int           timestamp;
+  std::uint64_t acquired_ns;   // Sensor acquisition (0 if unknown)
+  std::uint64_t ingest_ns;     // Frame received by the processor
+  std::uint64_t processed_ns;  // Sensor processing complete
+  std::uint64_t reported_ns;   // Frame report and subscribers done
+};
+
+/**
+ * @brief Stamps the stages of one frame: start() takes a clock_gettime anchor, now_ns() extends it with the cycle
+ *        counter
+ *
+ */
+class StageClock {
+ public:
+  StageClock() { calibrate_cycle_clock(); }  // Before any frame, so the calibration wait is not charged to one
+
+  void start() {
+    anchor_ns_     = monotonic_ns();
+    anchor_cycles_ = cycle_count();
+  }
+
+  std::uint64_t anchor_ns() const { return anchor_ns_; }
+  std::uint64_t now_ns() const { return anchor_ns_ + cycles_to_ns(cycle_count() - anchor_cycles_); }
+
+ private:
+  std::uint64_t anchor_ns_{0};
+  std::uint64_t anchor_cycles_{0};
+};
+
+/**
+ * @brief Log-linear latency histogram: 16 sub-buckets per power of two (about 6% resolution), O(1) record,
+ *        fixed 8 KB footprint
+ *
+ */
+class LatencyHistogram {
+ public:
+  static constexpr unsigned    sub_bits{4};  // log2 of the sub-buckets per power of two
+  static constexpr std::size_t bucket_count{64 << sub_bits};
+
+  void record(std::uint64_t ns);
+
+  std::uint64_t count() const { return count_; }
+  std::uint64_t min() const { return count_ == 0 ? 0 : min_; }
+  std::uint64_t max() const { return max_; }
+  double        mean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_); }
+
+  /**
+   * @brief Value at quantile q (0..1), reported as the upper edge of its bucket and capped at max()
+   *
+   * @param q
+   * @return std::uint64_t
+   */
+  std::uint64_t percentile(double q) const;
+
+ private:
+  std::array<std::uint64_t, bucket_count> counts_{};
+  std::uint64_t                           count_{0};
+  std::uint64_t                           sum_{0};
+  std::uint64_t                           min_{~std::uint64_t{0}};
+  std::uint64_t                           max_{0};
+};
@@ -0,0 +1,122 @@
+/**
+ * @file    health_monitor.hpp
+ * @author  Chris Collins
+ * @brief   Rolling sensor validity rates over several time horizons (e.g. 1 s, 1 min, 1 h) with threshold alerts.
+ *          Each horizon is a ring of time buckets with running totals, so recording a reading is O(1) and alerts
+ *          are raised without scanning history.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One rolling window: buckets x bucket_ms milliseconds
+ *
+ */
+struct HealthHorizon {
+  std::string   name;       // Display name, e.g. "1s"
+  std::uint64_t bucket_ms;  // Bucket width [ms]
+  std::uint32_t buckets;    // Buckets in the ring
+};
+
+struct HealthConfig {
+  std::vector<HealthHorizon> horizons{{"1s", 100, 10}, {"1min", 1000, 60}, {"1h", 60000, 60}};
+  double                     threshold{health_alert_threshold};
+  double                     hysteresis{health_clear_hysteresis};
+  std::uint32_t              min_samples{health_min_samples};
+};
+
+/**
+ * @brief Alert raised or cleared when a sensor's rolling validity rate crosses the threshold
+ *
+ */
+struct HealthEvent {
+  std::size_t   sensor;
+  std::size_t   horizon;  // Index into HealthConfig::horizons
+  double        rate;     // Validity rate when the event fired
+  bool          raised;   // true = dropped below threshold, false = recovered
+  std::uint64_t time_ms;
+};
+
+/**
+ * @brief Rolling validity rates for a fixed number of sensors
+ *
+ * Memory is allocated once in the constructor: per sensor and horizon, a ring of (valid, total) buckets plus running
+ * sums and alert state, roughly 8 bytes per bucket. The default horizons use 130 buckets, about 1 KB per sensor.
+ * Time must not go backwards per sensor.
+ */
+class HealthMonitor {
+ public:
+  /**
+   * @brief Create the monitor
+   *
+   * @param sensors Number of sensors
+   * @param config  Horizons and alert thresholds
+   * @throws std::invalid_argument if a horizon has no buckets or a zero bucket width
+   */
+  HealthMonitor(std::size_t sensors, const HealthConfig& config = HealthConfig{});
+
+  /**
+   * @brief Record one reading and append any alert transitions to events
+   *
+   * @param sensor  Sensor index
+   * @param valid   Whether the reading was valid
+   * @param time_ms Reading time [ms]
+   * @param events  Alert transitions are appended here
+   */
+  void record(std::size_t sensor, bool valid, std::uint64_t time_ms, std::vector<HealthEvent>& events);
+
+  /**
+   * @brief Validity rate of a sensor over a horizon as of its last recorded reading (1 when empty)
+   *
+   */
+  double rate(std::size_t sensor, std::size_t horizon) const;
+
+  /**
+   * @brief Readings of a sensor within a horizon as of its last recorded reading
+   *
+   */
+  std::uint32_t samples(std::size_t sensor, std::size_t horizon) const;
+
+  bool alerting(std::size_t sensor, std::size_t horizon) const { return windows_[index(sensor, horizon)].alerting; }
+
+  std::size_t         sensors() const { return sensors_; }
+  const HealthConfig& config() const { return config_; }
+
+ private:
+  struct Bucket {
+    std::uint32_t valid;
+    std::uint32_t total;
+  };
+
+  /**
+   * @brief Running state of one (sensor, horizon) ring
+   *
+   */
+  struct Window {
+    std::uint64_t epoch;      // Bucket number (time_ms / bucket_ms) of the newest bucket
+    std::uint32_t valid_sum;  // Sums over the ring
+    std::uint32_t total_sum;
+    bool          alerting;
+  };
+
+  std::size_t index(std::size_t sensor, std::size_t horizon) const { return sensor * horizons_ + horizon; }
+
+  HealthConfig             config_;
+  std::size_t              sensors_;
+  std::size_t              horizons_;
+  std::vector<std::size_t> offsets_{};  // First bucket of each horizon within a sensor's block
+  std::size_t              buckets_per_sensor_{0};
+  std::vector<Bucket>      buckets_{};  // [sensor][horizon][bucket]
+  std::vector<Window>      windows_{};  // [sensor][horizon]
+};
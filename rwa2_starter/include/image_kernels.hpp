@@ -0,0 +1,183 @@
+/**
+ * @file    image_kernels.hpp
+ * @author  Chris Collins
+ * @brief   Camera image kernels on strided 8-bit buffers: RGB to grayscale / YUV conversion and 2x pyramid reduction
+ *          (box or 5-tap Gaussian). Every kernel writes a caller-provided output and processes a range of output
+ *          rows, so rows can be split across a thread pool with parallel_rows().
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Writable view of an 8-bit image with interleaved channels
+ *
+ */
+struct ImageView {
+  std::uint8_t*  data{nullptr};
+  int            width{0};
+  int            height{0};
+  int            channels{1};
+  std::ptrdiff_t stride{0};  // Bytes between the starts of consecutive rows (>= width * channels)
+
+  std::uint8_t* row(int y) const { return data + y * stride; }
+};
+
+/**
+ * @brief Read-only view of an 8-bit image with interleaved channels
+ *
+ */
+struct ConstImageView {
+  const std::uint8_t* data{nullptr};
+  int                 width{0};
+  int                 height{0};
+  int                 channels{1};
+  std::ptrdiff_t      stride{0};  // Bytes between the starts of consecutive rows (>= width * channels)
+
+  ConstImageView() = default;
+  ConstImageView(const std::uint8_t* data, int width, int height, int channels, std::ptrdiff_t stride)
+      : data{data}, width{width}, height{height}, channels{channels}, stride{stride} {}
+  ConstImageView(const ImageView& view)  // Implicit so writable views can be passed as inputs
+      : data{view.data}, width{view.width}, height{view.height}, channels{view.channels}, stride{view.stride} {}
+
+  const std::uint8_t* row(int y) const { return data + y * stride; }
+};
+
+enum class PyramidFilter { Box, Gaussian };
+
+/**
+ * @brief Convert rows [row_begin, row_end) of an RGB image to BT.601 luma
+ *
+ * @param rgb       3-channel input
+ * @param gray      1-channel output of the same size
+ * @param row_begin First row to convert
+ * @param row_end   One past the last row to convert (-1 = image height)
+ * @throws std::invalid_argument on mismatched sizes or channel counts
+ */
+void rgb_to_gray(const ConstImageView& rgb, const ImageView& gray, int row_begin = 0, int row_end = -1);
+
+/**
+ * @brief Convert rows [row_begin, row_end) of an RGB image to full-range BT.601 YUV 4:4:4 planes
+ *
+ * @param rgb       3-channel input
+ * @param y         1-channel luma output of the same size
+ * @param u         1-channel Cb output of the same size
+ * @param v         1-channel Cr output of the same size
+ * @param row_begin First row to convert
+ * @param row_end   One past the last row to convert (-1 = image height)
+ * @throws std::invalid_argument on mismatched sizes or channel counts
+ */
+void rgb_to_yuv(const ConstImageView& rgb, const ImageView& y, const ImageView& u, const ImageView& v,
+                int row_begin = 0, int row_end = -1);
+
+/**
+ * @brief Output size of one pyramid reduction: half the width and height (rounded down)
+ *
+ */
+inline int pyramid_down_size(int size) { return size / 2; }
+
+/**
+ * @brief Reduce rows [row_begin, row_end) of dst from src at half resolution, any channel count
+ *
+ * Box averages each 2x2 block; Gaussian applies the separable [1 4 6 4 1] / 16 kernel centred on each block with
+ * replicated borders.
+ *
+ * @param src       Input image
+ * @param dst       Output of size pyramid_down_size(src.width) x pyramid_down_size(src.height), same channels
+ * @param filter    Reduction filter
+ * @param row_begin First output row
+ * @param row_end   One past the last output row (-1 = dst height)
+ * @param scratch   Gaussian working row of at least src.width * src.channels values (nullptr allocates one per call)
+ * @throws std::invalid_argument on mismatched sizes or channel counts
+ */
+void pyramid_down(const ConstImageView& src, const ImageView& dst, PyramidFilter filter, int row_begin = 0,
+                  int row_end = -1, std::int32_t* scratch = nullptr);
+
+/**
+ * @brief Mean of every channel over the whole image
+ *
+ * @param image
+ * @param means Output, one value per channel
+ */
+void channel_means(const ConstImageView& image, double* means);
+
+/**
+ * @brief Split rows [0, rows) into contiguous chunks, one per pool thread, and call fn(chunk, row_begin, row_end) for
+ *        each on the pool
+ *
+ * @tparam Fn   Callable taking (std::size_t chunk, int row_begin, int row_end); chunk < pool->size()
+ * @param rows  Number of rows
+ * @param pool  Threads to split the rows across (nullptr runs a single chunk on the calling thread)
+ * @param fn    Row-range kernel
+ */
+template <typename Fn>
+void parallel_rows(int rows, ThreadPool* pool, Fn&& fn) {
+  const std::size_t threads = pool == nullptr ? 1 : pool->size();
+  const int         chunks  = static_cast<int>(std::min(threads, static_cast<std::size_t>(std::max(rows, 1))));
+  if (chunks <= 1) {
+    fn(std::size_t{0}, 0, rows);
+    return;
+  }
+  const int chunk = (rows + chunks - 1) / chunks;
+  pool->run(static_cast<std::size_t>(chunks), [&fn, chunk, rows](std::size_t c) {
+    const int first = static_cast<int>(c) * chunk;
+    fn(c, std::min(rows, first), std::min(rows, first + chunk));
+  });
+}
+
+/**
+ * @brief 2x image pyramid over a caller-owned base image. Level buffers are pooled: rebuilding for frames of the
+ *        same size reuses them without allocating.
+ *
+ */
+class ImagePyramid {
+ public:
+  /**
+   * @brief Pyramid whose levels are reduced on a persistent pool of threads, started once here
+   *
+   * @param threads Threads each level's rows are split across (1 reduces on the calling thread)
+   */
+  explicit ImagePyramid(std::size_t threads = 1);
+
+  /**
+   * @brief Build reduced levels 1..levels from base (level 0). Stops early once a level would be empty.
+   *
+   * @param base    Full-resolution image, must outlive the pyramid's use of level 0
+   * @param levels  Number of reduced levels
+   * @param filter  Reduction filter
+   */
+  void build(const ConstImageView& base, std::size_t levels, PyramidFilter filter = PyramidFilter::Box);
+
+  /**
+   * @brief Number of levels including the base
+   *
+   */
+  std::size_t size() const { return 1 + levels_; }
+
+  /**
+   * @brief Level i (0 = base)
+   *
+   * @param i Level index, clamped to the smallest level built
+   * @return ConstImageView
+   */
+  ConstImageView level(std::size_t i) const;
+
+ private:
+  std::unique_ptr<ThreadPool>             pool_;       // Row workers (null when reducing on the calling thread)
+  ConstImageView                          base_{};
+  std::vector<std::vector<std::uint8_t>>  storage_{};  // Pixel buffer of each reduced level (pooled)
+  std::vector<ImageView>                  views_{};    // View of each reduced level
+  std::vector<std::vector<std::int32_t>>  scratch_{};  // Gaussian working row of each row chunk (pooled)
+  std::size_t                             levels_{0};  // Reduced levels built by the last build()
+};
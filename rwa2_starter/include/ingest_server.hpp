@@ -0,0 +1,187 @@
+/**
+ * @file    ingest_server.hpp
+ * @author  Chris Collins
+ * @brief   Socket ingest for sensor frames from remote producers: an edge-triggered epoll server on a Unix domain
+ *          or loopback TCP socket and a producer-side client, exchanging length-prefixed frames (frame_codec.hpp)
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "frame_codec.hpp"
+#include "sensor_types.hpp"
+#include "shm_transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t ingest_buffer_bytes{64 * 1024};  // Per-connection receive buffer (holds many small frames)
+constexpr int         ingest_max_events{64};           // epoll events handled per wait
+constexpr int         ingest_max_connections{1024};    // Simultaneous producers
+
+/**
+ * @brief Socket address for the ingest server and client
+ *
+ */
+struct IngestEndpoint {
+  enum class Kind { Unix, Tcp };
+  Kind        kind{Kind::Unix};
+  std::string path{};    // Unix socket path
+  int         port{0};   // Loopback TCP port (0 lets the server pick one)
+
+  /**
+   * @brief Parse "unix:<path>" or "tcp:<port>"
+   *
+   * @param spec Endpoint string
+   * @return IngestEndpoint
+   * @throws std::invalid_argument on an unknown prefix
+   */
+  static IngestEndpoint parse(const std::string& spec);
+};
+
+/**
+ * @brief Single-threaded edge-triggered epoll server accepting frames from many producers
+ *
+ * Each connection owns a fixed receive buffer that is allocated the first time its slot is used and kept for later
+ * connections. Readable sockets are drained with large reads until EAGAIN and every complete frame in the buffer is
+ * decoded into one reusable SharedFrame and handed to the caller's handler, so the hot path does not allocate.
+ */
+class IngestServer {
+ public:
+  /**
+   * @brief Bind and listen on endpoint
+   *
+   * @param endpoint Unix socket path or loopback TCP port
+   * @throws std::runtime_error if the socket cannot be created, bound or registered with epoll
+   */
+  explicit IngestServer(const IngestEndpoint& endpoint);
+  ~IngestServer();
+
+  IngestServer(const IngestServer&)            = delete;
+  IngestServer& operator=(const IngestServer&) = delete;
+
+  /**
+   * @brief Wait up to timeout_ms for socket activity, accept new producers and deliver every complete frame
+   *
+   * @tparam Fn        Callable taking const SharedFrame&
+   * @param on_frame   Frame handler
+   * @param timeout_ms epoll_wait timeout
+   * @return std::size_t Number of frames delivered
+   */
+  template <typename Fn>
+  std::size_t poll(Fn&& on_frame, int timeout_ms = 100) {
+    std::size_t frames{0};
+    const int   ready = wait_readable(timeout_ms);
+    for (int i{0}; i < ready; ++i) {
+      Connection& conn = connections_[readable_[static_cast<std::size_t>(i)]];
+      for (;;) {  // Edge-triggered: keep reading until the socket reports EAGAIN
+        const ReadResult result = read_some(conn);
+        if (result != ReadResult::WouldBlock) { frames += drain(conn, on_frame); }
+        if (result == ReadResult::Data && !conn.protocol_error) { continue; }
+        if (result == ReadResult::Closed || conn.protocol_error) { close_connection(conn); }
+        break;
+      }
+    }
+    return frames;
+  }
+
+  int         port() const { return port_; }  // Bound TCP port (0 for Unix sockets)
+  std::size_t active_connections() const { return active_; }
+  std::size_t total_connections() const { return accepted_; }
+  std::size_t protocol_errors() const { return protocol_errors_; }
+
+ private:
+  struct Connection {
+    int                        fd{-1};
+    std::vector<unsigned char> buffer{};  // Receive buffer, allocated on first use of this slot
+    std::size_t                begin{0};  // First unconsumed byte
+    std::size_t                end{0};    // One past the last received byte
+    bool                       protocol_error{false};
+  };
+
+  enum class ReadResult { Data, WouldBlock, Closed };
+
+  int        wait_readable(int timeout_ms);
+  void       accept_all();
+  ReadResult read_some(Connection& conn);
+  void       close_connection(Connection& conn);
+
+  template <typename Fn>
+  std::size_t drain(Connection& conn, Fn& on_frame) {
+    std::size_t frames{0};
+    while (conn.end - conn.begin >= frame_header_bytes) {
+      std::uint32_t payload_bytes{0};
+      std::memcpy(&payload_bytes, &conn.buffer[conn.begin], sizeof(payload_bytes));
+      if (payload_bytes > frame_max_payload_bytes) {  // Corrupt stream: drop this producer
+        conn.protocol_error = true;
+        ++protocol_errors_;
+        return frames;
+      }
+      if (conn.end - conn.begin < frame_header_bytes + payload_bytes) { break; }  // Partial frame
+
+      if (decode_frame(&conn.buffer[conn.begin + frame_header_bytes], payload_bytes, frame_)) {
+        on_frame(static_cast<const SharedFrame&>(frame_));
+        ++frames;
+      } else {
+        ++protocol_errors_;
+      }
+      conn.begin += frame_header_bytes + payload_bytes;
+    }
+    return frames;
+  }
+
+  int                     listen_fd_{-1};
+  int                     epoll_fd_{-1};
+  int                     port_{0};
+  std::string             unix_path_{};
+  std::vector<Connection> connections_;  // Slot per simultaneous producer
+  std::vector<std::size_t> free_slots_;  // Unused connection slots
+  std::vector<std::size_t> readable_;    // Connection slots reported readable by the last wait
+  SharedFrame             frame_{};      // Decode target reused for every frame
+  std::size_t             active_{0};
+  std::size_t             accepted_{0};
+  std::size_t             protocol_errors_{0};
+};
+
+/**
+ * @brief Producer-side connection that batches encoded frames into large writes
+ *
+ */
+class IngestClient {
+ public:
+  /**
+   * @brief Connect to an IngestServer
+   *
+   * @param endpoint Server endpoint
+   * @throws std::runtime_error if the connection fails
+   */
+  explicit IngestClient(const IngestEndpoint& endpoint);
+  ~IngestClient();
+
+  IngestClient(const IngestClient&)            = delete;
+  IngestClient& operator=(const IngestClient&) = delete;
+
+  /**
+   * @brief Queue one frame, writing the batch once it reaches the flush threshold
+   *
+   * @param data
+   */
+  void send(const TimestampData& data);
+
+  /**
+   * @brief Write every queued frame
+   *
+   * @throws std::runtime_error if the server closed the connection
+   */
+  void flush();
+
+ private:
+  int                        fd_{-1};
+  std::vector<unsigned char> pending_{};
+};
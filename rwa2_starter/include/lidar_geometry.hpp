@@ -0,0 +1,82 @@
+/**
+ * @file    lidar_geometry.hpp
+ * @author  Chris Collins
+ * @brief   LIDAR beam layout and polar-to-Cartesian conversion of range scans into x/y point clouds using a
+ *          sin/cos table computed once per layout
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Bearing of every beam in a scan: beam i points at start_angle + i * angle_increment
+ *
+ */
+struct BeamLayout {
+  std::size_t count;            // Beams per scan
+  double      start_angle;      // Bearing of beam 0 [deg]
+  double      angle_increment;  // Bearing step between beams [deg]
+
+  /**
+   * @brief Layout of count beams evenly spaced over a full revolution starting at lidar_start_angle
+   *
+   * @param count Beams per scan
+   * @return BeamLayout
+   */
+  static BeamLayout full_circle(std::size_t count) {
+    return {count, lidar_start_angle, count == 0 ? 0.0 : 360.0 / static_cast<double>(count)};
+  }
+};
+
+/**
+ * @brief Point cloud of one scan in the sensor frame, stored as separate x and y arrays
+ *
+ */
+struct PointCloud {
+  int                 timestamp{0};
+  std::vector<double> x{};  // [m]
+  std::vector<double> y{};  // [m]
+
+  std::size_t size() const { return x.size(); }
+};
+
+/**
+ * @brief Converts range scans of one beam layout into point clouds. The trig table is built in the constructor,
+ *        so project() is a multiply per coordinate with no trig calls.
+ *
+ */
+class LidarProjector {
+ public:
+  /**
+   * @brief Precompute cos/sin of every beam bearing
+   *
+   * @param layout Beam layout of the scans to convert
+   */
+  explicit LidarProjector(const BeamLayout& layout);
+
+  const BeamLayout& layout() const { return layout_; }
+
+  /**
+   * @brief Convert one scan to x/y points (out is resized, its capacity is reused across scans)
+   *
+   * @param timestamp Timestamp ID stored in out
+   * @param ranges    Distance readings [m], one per beam
+   * @param count     Number of readings, must equal layout().count
+   * @param out       Destination point cloud
+   * @throws std::invalid_argument if count does not match the layout
+   */
+  void project(int timestamp, const double* ranges, std::size_t count, PointCloud& out) const;
+
+ private:
+  BeamLayout          layout_;
+  std::vector<double> cos_{};  // cos of each beam bearing
+  std::vector<double> sin_{};  // sin of each beam bearing
+};
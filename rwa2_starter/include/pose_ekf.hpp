@@ -0,0 +1,86 @@
+/**
+ * @file    pose_ekf.hpp
+ * @author  Chris Collins
+ * @brief   Extended Kalman filter for planar robot pose fusing IMU heading with LIDAR scan-matching motion. Built on
+ *          Mat<R, C>, so predict and update never allocate.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * State x = [px, py, theta, v, omega]: position [m], heading [rad], forward velocity [m/s], yaw rate [rad/s].
+ * Motion model (unicycle, constant velocity and yaw rate):
+ *   px' = px + v cos(theta) dt,  py' = py + v sin(theta) dt,  theta' = theta + omega dt
+ */
+
+#pragma once
+
+#include "fixed_matrix.hpp"
+#include "scan_matcher.hpp"
+#include "sensor_types.hpp"
+
+/**
+ * @brief Noise parameters, standard deviations in SI units (radians)
+ *
+ */
+struct EkfConfig {
+  double heading_std;    // IMU yaw measurement [rad]
+  double velocity_std;   // Scan-matching forward velocity [m/s]
+  double yaw_rate_std;   // Scan-matching yaw rate [rad/s]
+  double accel_std;      // Process: forward acceleration [m/s^2]
+  double yaw_accel_std;  // Process: yaw acceleration [rad/s^2]
+
+  /**
+   * @brief Configuration from the ekf_* constants in sensor_types.hpp
+   *
+   * @return EkfConfig
+   */
+  static EkfConfig defaults();
+};
+
+class PoseEkf {
+ public:
+  static constexpr std::size_t state_size{5};
+  using State      = Vec<state_size>;
+  using Covariance = Mat<state_size, state_size>;
+
+  explicit PoseEkf(const EkfConfig& config = EkfConfig::defaults());
+
+  /**
+   * @brief Propagate the state and covariance by dt
+   *
+   * @param dt Time step [s]
+   */
+  void predict(double dt);
+
+  /**
+   * @brief Correct with an absolute heading measurement (e.g. IMU yaw)
+   *
+   * @param yaw Heading [rad]; the innovation is wrapped to (-pi, pi]
+   */
+  void update_heading(double yaw);
+
+  /**
+   * @brief Correct with relative motion from scan matching over dt, observed as forward velocity and yaw rate
+   *
+   * @param motion Transform of the new scan in the previous scan's frame
+   * @param dt     Time between the scans [s]
+   */
+  void update_motion(const Pose2D& motion, double dt);
+
+  const State&      state() const { return x_; }
+  const Covariance& covariance() const { return p_; }
+  Pose2D            pose() const { return {x_[0], x_[1], x_[2]}; }
+
+ private:
+  /**
+   * @brief Standard EKF measurement update with linear measurement matrix h
+   *
+   */
+  template <std::size_t M>
+  void correct(const Vec<M>& innovation, const Mat<M, state_size>& h, const Mat<M, M>& r);
+
+  EkfConfig  config_;
+  State      x_{};
+  Covariance p_;
+};
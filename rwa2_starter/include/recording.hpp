@@ -0,0 +1,231 @@
+/**
+ * @file    recording.hpp
+ * @author  Chris Collins
+ * @brief   Seekable sensor recording container: frames are stored in blocks, and a footer index maps each block's
+ *          timestamp range to its file offset along with min/max zone maps for LIDAR distance, brightness and
+ *          rotation, so replay queries seek straight to the blocks that can match
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * File layout (host byte order):
+ *   RecordingFileHeader
+ *   block 0 .. block N-1      encoded frames back to back (frame_codec.hpp)
+ *   RecordingBlock[N]         footer index
+ *   RecordingTrailer          footer offset, block count, magic
+ */
+
+#pragma once
+
+#include "frame_codec.hpp"
+#include "sensor_types.hpp"
+#include "shm_transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+constexpr std::size_t recording_block_frames{4096};     // Frames per block before it is flushed
+constexpr std::size_t recording_block_bytes{1 << 20};  // Encoded bytes per block before it is flushed
+
+/**
+ * @brief Index entry for one block: location plus per-block zone maps
+ *
+ */
+struct RecordingBlock {
+  std::uint64_t offset;          // File offset of the first encoded frame
+  std::uint32_t bytes;           // Encoded bytes in the block
+  std::uint32_t frames;          // Frames in the block
+  std::int32_t  t_min, t_max;    // Timestamp range
+  double        lidar_min, lidar_max;            // Smallest / largest single LIDAR reading [m]
+  double        brightness_min, brightness_max;  // Camera brightness range
+  double        rotation_min, rotation_max;      // IMU total rotation range [deg]
+};
+
+struct RecordingFileHeader {
+  char          magic[8];  // "RWA2REC"
+  std::uint32_t version;
+  std::uint32_t reserved;
+};
+
+struct RecordingTrailer {
+  std::uint64_t footer_offset;
+  std::uint64_t block_count;
+  char          magic[8];  // "RWA2IDX"
+};
+
+/**
+ * @brief Replay filter. Every range is inclusive and defaults to "anything".
+ *
+ */
+struct RecordingQuery {
+  int    t_begin{std::numeric_limits<int>::min()};
+  int    t_end{std::numeric_limits<int>::max()};
+  double lidar_min{-std::numeric_limits<double>::infinity()};  // Frame matches if ANY LIDAR reading is in range
+  double lidar_max{std::numeric_limits<double>::infinity()};
+  double brightness_min{-std::numeric_limits<double>::infinity()};
+  double brightness_max{std::numeric_limits<double>::infinity()};
+  double rotation_min{-std::numeric_limits<double>::infinity()};
+  double rotation_max{std::numeric_limits<double>::infinity()};
+
+  /**
+   * @brief Query for frames with at least one obstacle (a reading <= obstacle_threshold)
+   *
+   * @return RecordingQuery
+   */
+  static RecordingQuery obstacles_only() {
+    RecordingQuery query{};
+    query.lidar_max = obstacle_threshold;
+    return query;
+  }
+};
+
+/**
+ * @brief Counts from one replay, showing how much of the file the index let the query skip
+ *
+ */
+struct ReplayStats {
+  std::size_t blocks_read{0};
+  std::size_t blocks_skipped{0};
+  std::size_t frames_scanned{0};
+  std::size_t frames_matched{0};
+};
+
+/**
+ * @brief True if the block's zone maps overlap every range of the query
+ *
+ * @param block
+ * @param query
+ * @return true  Block may contain matching frames and must be read
+ */
+bool block_may_match(const RecordingBlock& block, const RecordingQuery& query);
+
+/**
+ * @brief True if the decoded frame satisfies every range of the query
+ *
+ * @param frame
+ * @param query
+ * @return true
+ */
+bool frame_matches(const SharedFrame& frame, const RecordingQuery& query);
+
+/**
+ * @brief Writes frames into a block-structured recording and appends the footer index on finish()
+ *
+ */
+class RecordingWriter {
+ public:
+  /**
+   * @brief Create (truncate) the recording at path
+   *
+   * @param path
+   * @param block_frames Frames per block
+   * @throws std::runtime_error if the file cannot be opened
+   */
+  explicit RecordingWriter(const std::string& path, std::size_t block_frames = recording_block_frames);
+  ~RecordingWriter();
+
+  RecordingWriter(const RecordingWriter&)            = delete;
+  RecordingWriter& operator=(const RecordingWriter&) = delete;
+
+  void append(const TimestampData& data);
+  void append(const SharedFrame& frame);
+
+  /**
+   * @brief Flush the last block and write the footer index and trailer. Called by the destructor if needed.
+   *
+   */
+  void finish();
+
+  std::size_t blocks_written() const { return index_.size(); }
+
+ private:
+  void add_to_block(int timestamp, const double* lidar, std::size_t count, const CameraData& camera,
+                    const ImuData& imu);
+  void flush_block();
+
+  std::ofstream               file_;
+  std::size_t                 block_frames_;
+  std::vector<unsigned char>  block_{};   // Encoded frames of the open block
+  RecordingBlock              current_{};  // Zone maps of the open block
+  std::vector<RecordingBlock> index_{};
+  std::uint64_t               offset_{0};  // File offset where the open block will be written
+  bool                        finished_{false};
+};
+
+/**
+ * @brief Opens a recording by reading only its trailer and footer index, then replays matching frames
+ *
+ */
+class RecordingReader {
+ public:
+  /**
+   * @brief Open path and load the block index (file size does not matter, only the footer is read)
+   *
+   * @param path
+   * @throws std::runtime_error if the file is missing, truncated or not a recording
+   */
+  explicit RecordingReader(const std::string& path);
+
+  const std::vector<RecordingBlock>& blocks() const { return blocks_; }
+  std::size_t                        frame_count() const;
+
+  /**
+   * @brief Deliver every frame matching query, reading only blocks whose index entry can match
+   *
+   * @tparam Fn      Callable taking const SharedFrame&
+   * @param query    Time range and value ranges
+   * @param on_frame Frame handler
+   * @return ReplayStats
+   */
+  template <typename Fn>
+  ReplayStats replay(const RecordingQuery& query, Fn&& on_frame) {
+    ReplayStats stats{};
+    const std::size_t first = first_candidate(query);
+    stats.blocks_skipped    = first;
+    for (std::size_t i{first}; i < blocks_.size(); ++i) {
+      const RecordingBlock& block = blocks_[i];
+      if (time_sorted_ && block.t_min > query.t_end) {  // Every later block is past the range
+        stats.blocks_skipped += blocks_.size() - i;
+        break;
+      }
+      if (!block_may_match(block, query)) {
+        ++stats.blocks_skipped;
+        continue;
+      }
+
+      load_block(block);
+      ++stats.blocks_read;
+      std::size_t position{0};
+      while (position + frame_header_bytes <= buffer_.size()) {
+        std::uint32_t payload_bytes{0};
+        std::memcpy(&payload_bytes, &buffer_[position], sizeof(payload_bytes));
+        if (position + frame_header_bytes + payload_bytes > buffer_.size() ||
+            !decode_frame(&buffer_[position + frame_header_bytes], payload_bytes, frame_)) {
+          break;  // Corrupt block: skip the rest of it
+        }
+        position += frame_header_bytes + payload_bytes;
+        ++stats.frames_scanned;
+        if (frame_matches(frame_, query)) {
+          ++stats.frames_matched;
+          on_frame(static_cast<const SharedFrame&>(frame_));
+        }
+      }
+    }
+    return stats;
+  }
+
+ private:
+  std::size_t first_candidate(const RecordingQuery& query) const;
+  void        load_block(const RecordingBlock& block);
+
+  std::ifstream               file_;
+  std::vector<RecordingBlock> blocks_{};
+  bool                        time_sorted_{true};  // Blocks are in timestamp order, so the time index can be searched
+  std::vector<unsigned char>  buffer_{};           // Current block, reused across blocks
+  SharedFrame                 frame_{};            // Decode target reused for every frame
+};
@@ -0,0 +1,151 @@
+/**
+ * @file    roaring_bitmap.hpp
+ * @author  Chris Collins
+ * @brief   Compressed bitmap of 32-bit row IDs in the roaring layout: IDs are split by their high 16 bits into
+ *          containers that are either a sorted array (sparse) or a 65536-bit bitmap (dense)
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Roaring-style compressed bitmap with AND / OR / AND-NOT
+ *
+ */
+class RoaringBitmap {
+ public:
+  /**
+   * @brief Add a row ID. Appending IDs in ascending order is the fast path.
+   *
+   * @param value
+   */
+  void add(std::uint32_t value);
+
+  bool          contains(std::uint32_t value) const;
+  std::uint64_t cardinality() const;
+  bool          empty() const { return containers_.empty(); }
+
+  /**
+   * @brief Call fn(id) for every row ID in ascending order
+   *
+   * @tparam Fn
+   * @param fn
+   */
+  template <typename Fn>
+  void for_each(Fn&& fn) const {
+    for (const auto& c : containers_) {
+      const std::uint32_t high = static_cast<std::uint32_t>(c.key) << 16;
+      if (c.bits.empty()) {
+        for (const std::uint16_t low : c.array) { fn(high | low); }
+      } else {
+        for (std::size_t w{0}; w < c.bits.size(); ++w) {
+          std::uint64_t word = c.bits[w];
+          while (word != 0) {
+            fn(high | static_cast<std::uint32_t>(w * 64 + static_cast<std::size_t>(__builtin_ctzll(word))));
+            word &= word - 1;
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Row IDs for which keep(id) is true. Costs one keep() call per row ID in the bitmap, so filtering a small
+   *        candidate set touches only those rows.
+   *
+   * @tparam Keep Callable taking std::uint32_t, returning bool
+   * @param keep
+   * @return RoaringBitmap
+   */
+  template <typename Keep>
+  RoaringBitmap filter(Keep&& keep) const {
+    RoaringBitmap result;
+    result.containers_.reserve(containers_.size());
+    for (const auto& c : containers_) {
+      const std::uint32_t high = static_cast<std::uint32_t>(c.key) << 16;
+      Container           out{c.key, 0, {}, {}};
+      if (c.bits.empty()) {
+        out.array.reserve(c.array.size());
+        for (const std::uint16_t low : c.array) {
+          if (keep(high | low)) { out.array.push_back(low); }
+        }
+        out.cardinality = static_cast<std::uint32_t>(out.array.size());
+      } else {
+        out.bits.assign(bitmap_words, 0);
+        for (std::size_t w{0}; w < bitmap_words; ++w) {
+          std::uint64_t word = c.bits[w];
+          std::uint64_t kept{0};
+          while (word != 0) {  // Branch-free per row: the predicate result is shifted into place
+            const auto bit = static_cast<std::uint32_t>(__builtin_ctzll(word));
+            kept |= static_cast<std::uint64_t>(keep(high | static_cast<std::uint32_t>(w * 64 + bit))) << bit;
+            word &= word - 1;
+          }
+          out.bits[w] = kept;
+        }
+        out.cardinality = popcount(out.bits.data(), bitmap_words);
+        normalize(out);
+      }
+      if (out.cardinality != 0) { result.containers_.push_back(std::move(out)); }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Row IDs in ascending order
+   *
+   * @return std::vector<std::uint32_t>
+   */
+  std::vector<std::uint32_t> to_vector() const;
+
+  /**
+   * @brief Build from a dense bit vector where bit j of words[w] is row w * 64 + j
+   *
+   * @param words
+   * @param word_count
+   * @return RoaringBitmap
+   */
+  static RoaringBitmap from_words(const std::uint64_t* words, std::size_t word_count);
+
+  /**
+   * @brief Every row ID in [0, count)
+   *
+   * @param count
+   * @return RoaringBitmap
+   */
+  static RoaringBitmap range(std::uint32_t count);
+
+  friend RoaringBitmap operator&(const RoaringBitmap& a, const RoaringBitmap& b);
+  friend RoaringBitmap operator|(const RoaringBitmap& a, const RoaringBitmap& b);
+  friend RoaringBitmap and_not(const RoaringBitmap& a, const RoaringBitmap& b);
+
+ private:
+  static constexpr std::size_t array_max{4096};  // Larger containers are stored as bitmaps
+  static constexpr std::size_t bitmap_words{1024};
+
+  struct Container {
+    std::uint16_t              key{0};       // High 16 bits shared by every ID in the container
+    std::uint32_t              cardinality{0};
+    std::vector<std::uint16_t> array{};      // Sorted low bits (array form)
+    std::vector<std::uint64_t> bits{};       // 65536-bit bitmap (bitmap form, empty in array form)
+  };
+
+  enum class Op { And, Or, AndNot };
+
+  static std::uint32_t popcount(const std::uint64_t* words, std::size_t count);
+  static Container combine(const Container& a, const Container& b, Op op);
+  static void      extract(const std::uint64_t* words, Container& c);  // Array form of words, c.cardinality set
+  static void      to_bitmap(Container& c);
+  static void      normalize(Container& c);
+  static RoaringBitmap merge(const RoaringBitmap& a, const RoaringBitmap& b, Op op);
+
+  std::vector<Container> containers_;  // Sorted by key
+};
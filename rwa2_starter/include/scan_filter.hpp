@@ -0,0 +1,69 @@
+/**
+ * @file    scan_filter.hpp
+ * @author  Chris Collins
+ * @brief   LIDAR scan repair: windowed median across neighbouring beams and recent scans computed with a min/max
+ *          sorting network, replacing invalid or outlying beams in place instead of failing the whole scan
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+struct ScanFilterConfig {
+  double min_valid{lidar_min_valid};                             // Beams below this are always replaced [m]
+  double max_deviation{std::numeric_limits<double>::infinity()};  // Beams farther than this from their median are
+                                                                  // also replaced [m] (off by default)
+};
+
+/**
+ * @brief Outcome of filtering one scan, published to frame subscribers
+ *
+ */
+struct ScanFilterResult {
+  int         timestamp;
+  std::size_t repaired;    // Beams replaced by their median
+  std::size_t unrepaired;  // Bad beams left as-is because their median was bad too
+};
+
+/**
+ * @brief Median filter over a 5-sample cross window: the beam, its two neighbours, and either the same beam in the
+ *        two previous scans or (until two scans have been seen) the next neighbours out. Scans are treated as
+ *        circular. Buffers are reused across scans; a change of beam count restarts the temporal history.
+ *
+ */
+class ScanFilter {
+ public:
+  explicit ScanFilter(const ScanFilterConfig& config = ScanFilterConfig{});
+
+  /**
+   * @brief Replace bad beams of one scan in place
+   *
+   * @param timestamp Timestamp ID stored in the result
+   * @param ranges    Distance readings [m], modified in place
+   * @param count     Number of readings
+   * @return ScanFilterResult
+   */
+  ScanFilterResult filter(int timestamp, double* ranges, std::size_t count);
+
+  /**
+   * @brief Forget previous scans
+   *
+   */
+  void reset() { history_ = 0; }
+
+ private:
+  ScanFilterConfig    config_;
+  std::vector<double> padded_{};    // Current scan with 2 wrapped beams on each side
+  std::vector<double> median_{};    // Window median of each beam
+  std::vector<double> previous_{};  // Filtered scan t-1
+  std::vector<double> older_{};     // Filtered scan t-2
+  std::size_t         history_{0};  // Filtered scans available (capped at 2)
+};
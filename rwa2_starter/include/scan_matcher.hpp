@@ -0,0 +1,146 @@
+/**
+ * @file    scan_matcher.hpp
+ * @author  Chris Collins
+ * @brief   2D ICP scan matching between consecutive LIDAR point clouds: KD-tree nearest-neighbour index over the
+ *          reference scan, point-to-point and point-to-line error metrics, early-exit convergence
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "lidar_geometry.hpp"
+#include "sensor_types.hpp"
+#include "thread_pool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Rigid 2D transform: rotate by theta, then translate by (x, y)
+ *
+ */
+struct Pose2D {
+  double x{0.0};      // [m]
+  double y{0.0};      // [m]
+  double theta{0.0};  // [rad]
+};
+
+/**
+ * @brief Transform that applies inner first, then outer
+ *
+ * @param outer
+ * @param inner
+ * @return Pose2D
+ */
+Pose2D compose(const Pose2D& outer, const Pose2D& inner);
+
+/**
+ * @brief Balanced 2D KD-tree stored as an implicit array (median of each range is its root). build() reuses the
+ *        node storage, so rebuilding it for every scan does not allocate once it has reached the scan size.
+ *
+ */
+class KdTree2D {
+ public:
+  static constexpr std::size_t npos{std::numeric_limits<std::size_t>::max()};
+
+  /**
+   * @brief Index the points (x[i], y[i])
+   *
+   * @param x
+   * @param y
+   * @param count
+   */
+  void build(const double* x, const double* y, std::size_t count);
+
+  /**
+   * @brief Nearest indexed point to (qx, qy) closer than sqrt(max_distance_sq)
+   *
+   * @param qx
+   * @param qy
+   * @param max_distance_sq Squared search radius
+   * @param distance_sq     Squared distance to the returned point
+   * @return std::size_t    Index passed to build(), or npos if no point is within range
+   */
+  std::size_t nearest(double qx, double qy, double max_distance_sq, double& distance_sq) const;
+
+  std::size_t size() const { return index_.size(); }
+
+ private:
+  void build_range(std::size_t begin, std::size_t end, const double* x, const double* y);
+
+  std::vector<double>        x_{};      // Node coordinates in tree order
+  std::vector<double>        y_{};
+  std::vector<std::uint32_t> index_{};  // Original point index of each node
+  std::vector<std::uint8_t>  axis_{};   // Split axis of each node (0 = x, 1 = y)
+};
+
+enum class IcpMethod { PointToPoint, PointToLine };
+
+struct IcpConfig {
+  std::size_t max_iterations{icp_max_iterations};
+  double      tolerance{icp_tolerance};
+  double      max_correspondence_distance{icp_max_correspondence_distance};
+  IcpMethod   method{IcpMethod::PointToLine};  // Converges in fewer iterations on wall-like scans
+  std::size_t threads{1};  // Correspondence search threads (persistent pool), used for scans >= icp_parallel_min_points
+};
+
+struct IcpResult {
+  Pose2D      transform{};           // Maps the matched scan into the reference scan's frame
+  std::size_t iterations{0};
+  std::size_t correspondences{0};    // Pairs used in the last iteration
+  double      rms_error{0.0};        // RMS point-to-point distance of those pairs [m]
+  bool        converged{false};      // Stopped on tolerance rather than the iteration cap
+};
+
+/**
+ * @brief Aligns scans against a reference scan with ICP. Working buffers are members and reused across matches.
+ *
+ */
+class ScanMatcher {
+ public:
+  explicit ScanMatcher(const IcpConfig& config = IcpConfig{});
+
+  /**
+   * @brief Make scan the reference: copies it, estimates line normals and rebuilds the KD-tree
+   *
+   * @param scan
+   */
+  void set_reference(const PointCloud& scan);
+
+  bool has_reference() const { return tree_.size() != 0; }
+
+  /**
+   * @brief Estimate the transform mapping scan onto the reference
+   *
+   * @param scan    Scan to align
+   * @param initial Starting estimate
+   * @return IcpResult
+   * @throws std::runtime_error if no reference scan has been set
+   */
+  IcpResult match(const PointCloud& scan, const Pose2D& initial = Pose2D{});
+
+  const IcpConfig& config() const { return config_; }
+
+ private:
+  void find_correspondences(std::size_t count);
+  bool solve_point_to_point(std::size_t count, Pose2D& delta) const;
+  bool solve_point_to_line(std::size_t count, Pose2D& delta) const;
+
+  IcpConfig                   config_;
+  std::unique_ptr<ThreadPool> pool_;  // Correspondence search workers, started once (none when single-threaded)
+
+  KdTree2D            tree_{};
+  std::vector<double> ref_x_{}, ref_y_{};    // Reference points
+  std::vector<double> ref_nx_{}, ref_ny_{};  // Unit line normal at each reference point (0 if undefined)
+
+  // Per-match working buffers
+  std::vector<double>      moved_x_{}, moved_y_{};  // Scan points under the current estimate
+  std::vector<std::size_t> target_{};               // Reference index paired with each point, or KdTree2D::npos
+  std::vector<double>      distance_sq_{};          // Squared distance of each pair
+};
@@ -0,0 +1,25 @@
+/**
+ * @file    sensor_config.hpp
+ * @author  Chris Collins
+ * @brief   Sensors processed alongside the built-in LIDAR, Camera and IMU (builtin_sensors.hpp)
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_plugin.hpp"
+#include "ultrasonic_sensor.hpp"
+
+/**
+ * @brief Sensors beyond the built-in ones, each a sensor plugin (sensor_plugin.hpp). Listing a plugin here is all it
+ *        takes to simulate, process, publish and summarize it in the simulated run.
+ *
+ * The fixed frame layout (SharedFrame, the wire/recording codec) has no room for these readings, so shared-memory,
+ * socket and replayed frames carry none and the plugins are left out of those runs. Every plugin listed must provide
+ * simulate().
+ */
+using ExtraSensors = SensorSuite<UltrasonicSensor>;
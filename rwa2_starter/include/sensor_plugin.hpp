@@ -0,0 +1,229 @@
+/**
+ * @file    sensor_plugin.hpp
+ * @author  Chris Collins
+ * @brief   Statically composed sensor plugins: each sensor type supplies its reading and result types, processing
+ *          (validation and classification) and an optional summary contribution, and a SensorSuite composes any
+ *          number of them with tuples, variants and fold expressions so every call inlines with no virtual dispatch
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A sensor plugin is a class with:
+ *   using Reading = ...;                                     raw data for one timestamp
+ *   using Result  = ...;                                     processed result, published to the FrameBus
+ *   static constexpr const char* name;                       name used in summaries
+ *   static Result process(int timestamp, const Reading&);    validation and classification
+ *   static bool   valid(const Result&);                      STATUS: GOOD / POOR
+ * and optionally:
+ *   struct Summary { void add(const Result&); void print(std::ostream&) const; };  run summary contribution
+ *   template <typename Gen> static Reading simulate(Gen&);                        simulated readings
+ *
+ * Result types must be distinct across the plugins of a suite, since they are the FrameBus event types.
+ */
+
+#pragma once
+
+#include "frame_processing.hpp"
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/**
+ * @brief One reading of one sensor, tagged with its plugin so readings of identical types stay distinct in a variant
+ *
+ * @tparam Sensor Plugin type
+ */
+template <typename Sensor>
+struct SensorReading {
+  int                      timestamp;
+  typename Sensor::Reading reading;
+};
+
+namespace sensor_plugin_detail {
+/**
+ * @brief Stand-in for plugins without a Summary
+ *
+ */
+struct NoSummary {
+  template <typename Result>
+  void add(const Result&) {}
+  void print(std::ostream&) const {}
+};
+
+template <typename Sensor, typename = void>
+struct summary_of {
+  using type = NoSummary;
+};
+
+template <typename Sensor>
+struct summary_of<Sensor, std::void_t<typename Sensor::Summary>> {
+  using type = typename Sensor::Summary;
+};
+
+/**
+ * @brief Validity counts and summary of one plugin; one base of SensorReport per sensor
+ *
+ */
+template <typename Sensor>
+class SensorTally {
+ public:
+  void on(const typename Sensor::Result& result) {
+    ++total_;
+    valid_ += Sensor::valid(result) ? 1 : 0;
+    summary_.add(result);
+  }
+
+  int total() const { return total_; }
+  int valid() const { return valid_; }
+
+ protected:
+  void print(std::ostream& out) const {
+    if (total_ == 0) { return; }  // Sensor not present in this run's frame source
+    out << "- " << std::left << std::setw(9) << (std::string{Sensor::name} + ":") << std::right << valid_ << "/"
+        << total_ << "(" << std::fixed << std::setprecision(2)
+        << (total_ == 0 ? 0.0 : 100.0 * valid_ / total_) << "%)";
+    summary_.print(out);
+    out << '\n';
+  }
+
+ private:
+  int                               total_{0};
+  int                               valid_{0};
+  typename summary_of<Sensor>::type summary_{};
+};
+}  // namespace sensor_plugin_detail
+
+/**
+ * @brief FrameBus subscriber counting valid readings of every plugin in Sensors and printing their summaries at the
+ *        end of the run. One on() overload per plugin Result, inherited from the per-sensor tallies.
+ *
+ * @tparam Sensors Plugin types
+ */
+template <typename... Sensors>
+class SensorReport : public sensor_plugin_detail::SensorTally<Sensors>... {
+ public:
+  explicit SensorReport(std::ostream& out) : out_{&out} {}
+
+  using sensor_plugin_detail::SensorTally<Sensors>::on...;
+
+  void on(const RunComplete&) {
+    if ((sensor_plugin_detail::SensorTally<Sensors>::total() + ... + 0) == 0) { return; }
+    *out_ << "Sensor Plugins:\n";
+    (sensor_plugin_detail::SensorTally<Sensors>::print(*out_), ...);
+  }
+
+  template <typename Sensor>
+  const sensor_plugin_detail::SensorTally<Sensor>& tally() const { return *this; }
+
+ private:
+  std::ostream* out_;
+};
+
+/**
+ * @brief Static composition of sensor plugins
+ *
+ * A frame of the suite is a tuple holding one reading per plugin; process() runs every plugin's processing over it
+ * with a fold expression. Sensors that report at their own rate deliver single readings as the AnyReading variant,
+ * dispatched with std::visit to the matching plugin.
+ *
+ * @tparam Sensors Plugin types
+ */
+template <typename... Sensors>
+class SensorSuite {
+ public:
+  using Frame      = std::tuple<typename Sensors::Reading...>;               // One reading per sensor
+  using FrameView  = std::tuple<const typename Sensors::Reading&...>;        // Readings stored elsewhere
+  using Results    = std::tuple<typename Sensors::Result...>;                // One result per sensor
+  using AnyReading = std::variant<SensorReading<Sensors>...>;                // A reading of any one sensor
+  using Report     = SensorReport<Sensors...>;                               // Summary subscriber for the suite
+
+  static constexpr std::size_t size{sizeof...(Sensors)};
+
+  /**
+   * @brief Process one frame: every plugin's process() on its reading
+   *
+   * @param timestamp Timestamp ID
+   * @param frame     Readings in plugin order (a Frame converts without copying its readings)
+   * @return Results  Results in plugin order
+   */
+  static Results process(int timestamp, const FrameView& frame) {
+    return process_into<Results>(timestamp, frame);
+  }
+
+  /**
+   * @brief Process one frame straight into an aggregate Aggregate{leading..., results...}. Results are constructed
+   *        in place, in plugin order, with no intermediate tuple.
+   *
+   * @tparam Aggregate Type brace-initialized from the leading values followed by one Result per plugin
+   * @param timestamp  Timestamp ID
+   * @param frame      Readings in plugin order
+   * @param leading    Members that precede the results (e.g. the timestamp of a ProcessedFrame)
+   * @return Aggregate
+   */
+  template <typename Aggregate, typename... Leading>
+  static Aggregate process_into(int timestamp, const FrameView& frame, const Leading&... leading) {
+    return assemble<Aggregate>(timestamp, frame, std::index_sequence_for<Sensors...>{}, leading...);
+  }
+
+  /**
+   * @brief Publish every result of a frame to bus, in plugin order
+   *
+   * @tparam Bus FrameBus
+   * @param results
+   * @param bus
+   */
+  template <typename Bus>
+  static void publish(const Results& results, Bus& bus) {
+    std::apply([&bus](const auto&... result) { (bus.publish(result), ...); }, results);
+  }
+
+  /**
+   * @brief Process a single reading of any plugin and publish its result
+   *
+   * @tparam Bus FrameBus
+   * @param reading
+   * @param bus
+   */
+  template <typename Bus>
+  static void dispatch(const AnyReading& reading, Bus& bus) {
+    std::visit(
+        [&bus](const auto& tagged) {
+          using Sensor = typename sensor_of<std::decay_t<decltype(tagged)>>::type;
+          bus.publish(Sensor::process(tagged.timestamp, tagged.reading));
+        },
+        reading);
+  }
+
+  /**
+   * @brief Simulated readings for one frame (every plugin must provide simulate())
+   *
+   * @tparam Gen Random engine
+   * @param gen
+   * @return Frame
+   */
+  template <typename Gen>
+  static Frame simulate(Gen& gen) {
+    return Frame{Sensors::simulate(gen)...};  // Braced init: plugins draw from gen in order
+  }
+
+ private:
+  template <typename Tagged>
+  struct sensor_of;
+
+  template <typename Sensor>
+  struct sensor_of<SensorReading<Sensor>> {
+    using type = Sensor;
+  };
+
+  template <typename Aggregate, std::size_t... I, typename... Leading>
+  static Aggregate assemble(int timestamp, const FrameView& frame, std::index_sequence<I...>,
+                            const Leading&... leading) {
+    return Aggregate{leading..., Sensors::process(timestamp, std::get<I>(frame))...};  // Braced: in plugin order
+  }
+};
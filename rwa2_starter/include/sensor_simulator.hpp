@@ -0,0 +1,47 @@
+/**
+ * @file    sensor_simulator.hpp
+ * @author  Chris Collins
+ * @brief   Generates random LIDAR, Camera and IMU readings for one timestamp, shared by the rwa2 processor and the
+ *          standalone sensor producer
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include <random>
+
+/**
+ * @brief Random sensor data generator using the configured sensor ranges in sensor_types.hpp
+ *
+ */
+class SensorSimulator {
+ public:
+  SensorSimulator();
+
+  /**
+   * @brief Generate readings for one timestamp
+   *
+   * @param timestamp Timestamp ID stored in the returned data
+   * @return TimestampData
+   */
+  TimestampData next(int timestamp);
+
+  /**
+   * @brief Generate readings for one timestamp into existing storage (reuses the LIDAR vector capacity)
+   *
+   * @param timestamp Timestamp ID
+   * @param out       Destination
+   */
+  void next(int timestamp, TimestampData& out);
+
+ private:
+  std::mt19937                           gen_;
+  std::uniform_real_distribution<double> lidar_distrib_{lidar_min_range, lidar_max_range};
+  std::uniform_int_distribution<int>     camera_distrib_{rgb_min, rgb_max};
+  std::uniform_real_distribution<double> imu_distrib_{imu_min_rotation, imu_max_rotation};
+};
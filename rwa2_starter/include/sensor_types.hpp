@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <tuple>
 #include <string>
@@ -22,6 +24,7 @@ using ImuData = std::tuple<double, double, double>; // Roll, Pitch, Yaw in degre
 
 // General configuration
 constexpr int num_timestamps{5};
+constexpr double frame_period{0.1};  // Time between consecutive timestamps [s]
 
 // LIDAR configuration constants
 constexpr int lidar_readings_count{8};
@@ -29,18 +32,51 @@ constexpr double lidar_min_range{0.01};
 constexpr double lidar_max_range{10.0};
 constexpr double lidar_min_valid{0.05};
 constexpr double obstacle_threshold{2.0};
+constexpr double lidar_start_angle{0.0};       // Bearing of beam 0 [deg]
+constexpr double lidar_angle_increment{45.0};  // Bearing step between beams [deg]
+
+// Voxel downsampling configuration constants
+constexpr double voxel_cell_size{0.25};                // Voxel edge length [m]
+constexpr std::size_t voxel_accumulate_frames{50};     // Scans accumulated before each downsampled map
+constexpr std::size_t voxel_parallel_min_points{16384};  // Smaller batches are inserted on the calling thread
+
+// Scan matching (ICP) configuration constants
+constexpr std::size_t icp_max_iterations{30};            // Iteration cap per match
+constexpr double icp_tolerance{1e-6};                    // Stop once an update moves less than this [m, rad]
+constexpr double icp_max_correspondence_distance{1.0};   // Farther nearest neighbours are rejected [m]
+constexpr std::size_t icp_parallel_min_points{4096};     // Smaller scans search correspondences on one thread
+constexpr std::size_t icp_min_correspondences{4};        // Fewer pairs: a match is not used as a motion measurement
+constexpr double icp_min_overlap{0.5};                   // Nor when fewer than this fraction of the scan is paired
+
+// Pose estimator (EKF) configuration constants
+constexpr double ekf_heading_std{2.0};     // IMU yaw measurement noise [deg]
+constexpr double ekf_velocity_std{0.2};    // Scan-matching forward velocity noise [m/s]
+constexpr double ekf_yaw_rate_std{5.0};    // Scan-matching yaw rate noise [deg/s]
+constexpr double ekf_accel_std{1.0};       // Process noise: forward acceleration [m/s^2]
+constexpr double ekf_yaw_accel_std{30.0};  // Process noise: yaw acceleration [deg/s^2]
+
+// Sensor health monitor configuration constants
+constexpr double health_alert_threshold{0.9};   // Alert when a rolling validity rate drops below this
+constexpr double health_clear_hysteresis{0.02};  // Alert clears once the rate is back above threshold + this
+constexpr std::uint32_t health_min_samples{10};  // Readings in a horizon before it can alert
 
 // Camera configuration constants
 constexpr int rgb_min{0};
 constexpr int rgb_max{255};
 constexpr double brightness_threshold{20.0};
 constexpr double day_night_threshold{100.0};
+constexpr std::size_t camera_brightness_level{3};  // Pyramid level (1/8 resolution) used to classify camera images
 
 // IMU configuration constants
 constexpr double imu_min_rotation{-90.0};
 constexpr double imu_max_rotation{90.0};
 constexpr double imu_stability_threshold{5.0};
 
+// Anomaly detection configuration constants
+constexpr std::size_t anomaly_window{8};                   // Past frames kept for rolling statistics
+constexpr std::size_t anomaly_min_history{4};              // Frames required before scoring starts
+constexpr double anomaly_threshold{3.0};                   // Z-score (or scaled MAD score) that flags a frame
+
 
 // Structure to hold sensor readings at each timestamp
 struct TimestampData {
@@ -48,4 +84,5 @@ struct TimestampData {
     CameraData camera_readings;
     ImuData imu_readings;
     int timestamp;
+    std::uint64_t acquired_ns{0};  // Monotonic acquisition time [ns] (CLOCK_MONOTONIC, 0 if unknown)
 };
@@ -0,0 +1,229 @@
+/**
+ * @file    shm_transport.hpp
+ * @author  Chris Collins
+ * @brief   POSIX shared-memory ring for handing sensor frames from a producer process to processor processes.
+ *          Single writer, any number of readers, per-slot sequence numbers and futex wakeups. The writer fills
+ *          slots in place; readers copy the used part of a frame out of its slot and validate the copy before
+ *          handing it on, and nothing is serialized.
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "sensor_types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+constexpr int           shm_max_lidar_readings{1080};  // Largest scan a shared frame can hold
+constexpr std::uint32_t shm_default_capacity{256};     // Default number of ring slots (power of two)
+constexpr int           shm_default_spin{2000};        // Reader polls before sleeping on the futex
+
+/**
+ * @brief Fixed-layout frame stored directly in shared memory (trivially copyable, no pointers)
+ *
+ */
+struct SharedFrame {
+  int           timestamp;
+  int           lidar_count;                    // Valid entries in lidar[]
+  std::uint64_t acquired_ns;                    // Monotonic acquisition time [ns] (0 if unknown)
+  double        lidar[shm_max_lidar_readings];  // LIDAR distance readings [m]
+  int           rgb[3];                         // Camera R, G, B
+  double        rpy[3];                         // IMU Roll, Pitch, Yaw [deg]
+
+  CameraData camera() const { return {rgb[0], rgb[1], rgb[2]}; }
+  ImuData    imu() const { return {rpy[0], rpy[1], rpy[2]}; }
+};
+
+/**
+ * @brief Copy a TimestampData into a shared frame (producer side)
+ *
+ * @param data Source readings
+ * @param out  Destination slot
+ */
+void fill_shared_frame(const TimestampData& data, SharedFrame& out);
+
+/**
+ * @brief Outcome of a reader poll
+ *
+ */
+enum class ShmReadStatus {
+  Frame,    // A frame was delivered to the callback
+  Timeout,  // No new frame within the timeout
+  Overrun,  // Reader fell more than one ring behind; frames were skipped and the cursor moved forward
+  Closed    // Writer closed the ring and every frame has been read
+};
+
+namespace shm_detail {
+constexpr std::uint32_t ring_magic{0x52574132};  // "RWA2"
+constexpr std::uint32_t ring_version{2};
+
+/**
+ * @brief Ring control block at the start of the mapping. Writer-owned counters sit on their own cache lines.
+ *
+ */
+struct RingHeader {
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint32_t capacity;     // Number of slots (power of two)
+  std::uint32_t frame_bytes;  // sizeof(SharedFrame) of the writer, checked by readers
+
+  alignas(64) std::atomic<std::uint64_t> published;  // Number of frames published
+  alignas(64) std::atomic<std::uint32_t> futex_word;  // Bumped on every publish, readers futex-wait on it
+  std::atomic<std::uint32_t> waiters;                 // Readers currently sleeping (writer skips wake when 0)
+  std::atomic<std::uint32_t> closed;                  // Set once by the writer at shutdown
+};
+
+/**
+ * @brief One ring slot. seq is 2*n while frame n (1-based) is readable and 2*n-1 while it is being written.
+ *
+ */
+struct alignas(64) RingSlot {
+  std::atomic<std::uint64_t> seq;
+  SharedFrame                frame;
+};
+
+std::size_t mapping_bytes(std::uint32_t capacity);
+}  // namespace shm_detail
+
+/**
+ * @brief Creates the shared-memory ring and publishes frames into it
+ *
+ */
+class ShmFrameWriter {
+ public:
+  /**
+   * @brief Create (or replace) the ring /name with capacity slots
+   *
+   * @param name     Shared-memory object name (leading '/' optional)
+   * @param capacity Number of slots, rounded up to a power of two
+   * @throws std::runtime_error if the object cannot be created or mapped
+   */
+  ShmFrameWriter(const std::string& name, std::uint32_t capacity = shm_default_capacity);
+  ~ShmFrameWriter();
+
+  ShmFrameWriter(const ShmFrameWriter&)            = delete;
+  ShmFrameWriter& operator=(const ShmFrameWriter&) = delete;
+
+  /**
+   * @brief Reserve the next slot for writing in place. Must be followed by publish().
+   *
+   * @return SharedFrame& Slot to fill
+   */
+  SharedFrame& claim();
+
+  /**
+   * @brief Make the claimed slot visible to readers and wake sleeping readers
+   *
+   */
+  void publish();
+
+  /**
+   * @brief claim(), fill from data, publish()
+   *
+   * @param data
+   */
+  void write(const TimestampData& data);
+
+  /**
+   * @brief Mark the ring closed so readers return ShmReadStatus::Closed after the last frame
+   *
+   */
+  void close();
+
+ private:
+  std::string              name_;
+  shm_detail::RingHeader*  header_{nullptr};
+  shm_detail::RingSlot*    slots_{nullptr};
+  std::size_t              bytes_{0};
+  std::uint64_t            next_{1};  // Sequence number of the next frame
+};
+
+/**
+ * @brief Attaches to an existing ring and reads validated copies of its frames
+ *
+ */
+class ShmFrameReader {
+ public:
+  /**
+   * @brief Map the ring /name. Starts at the oldest frame still in the ring.
+   *
+   * @param name Shared-memory object name used by the writer
+   * @throws std::runtime_error if the ring does not exist or has an incompatible layout
+   */
+  explicit ShmFrameReader(const std::string& name);
+  ~ShmFrameReader();
+
+  ShmFrameReader(const ShmFrameReader&)            = delete;
+  ShmFrameReader& operator=(const ShmFrameReader&) = delete;
+
+  /**
+   * @brief Wait for the next frame, copy it out of its slot and pass the copy to fn
+   *
+   * Only the frame's lidar_count readings are copied, not the whole fixed-size scan array. The slot is re-validated
+   * after the copy and before fn runs: if the writer lapped the reader during the copy,
+   * fn is not called for that frame and the result is Overrun, so fn never sees a torn frame.
+   *
+   * @tparam Fn         Callable taking const SharedFrame&
+   * @param fn          Frame handler
+   * @param timeout_ms  Maximum time to wait for a frame
+   * @return ShmReadStatus
+   */
+  template <typename Fn>
+  ShmReadStatus read(Fn&& fn, int timeout_ms = 1000) {
+    const ShmReadStatus status = wait_for_next(timeout_ms);
+    if (status != ShmReadStatus::Frame) { return status; }
+
+    shm_detail::RingSlot& slot = slot_for(next_);
+    copy_used(slot.frame);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) != 2 * next_) {  // Overwritten while being copied
+      ++overruns_;
+      skip_to_oldest();
+      return ShmReadStatus::Overrun;
+    }
+    ++next_;
+    fn(static_cast<const SharedFrame&>(frame_));
+    return ShmReadStatus::Frame;
+  }
+
+  std::uint64_t overruns() const { return overruns_; }
+  std::uint64_t next_sequence() const { return next_; }
+
+ private:
+  /**
+   * @brief Copy the parts of a slot's frame that are in use into frame_: the fields before the scan, lidar_count
+   *        readings (clamped, the count may be torn until the slot is re-validated) and the fields after the scan
+   *
+   * @param src Frame in its ring slot
+   */
+  void copy_used(const SharedFrame& src) {
+    constexpr std::size_t scan_offset{offsetof(SharedFrame, lidar)};
+    constexpr std::size_t tail_offset{offsetof(SharedFrame, rgb)};
+    auto*                 dst = reinterpret_cast<unsigned char*>(&frame_);
+    const auto*           raw = reinterpret_cast<const unsigned char*>(&src);
+    std::memcpy(dst, raw, scan_offset);
+    const auto count = static_cast<std::size_t>(std::clamp(frame_.lidar_count, 0, shm_max_lidar_readings));
+    std::memcpy(frame_.lidar, src.lidar, count * sizeof(double));
+    std::memcpy(dst + tail_offset, raw + tail_offset, sizeof(SharedFrame) - tail_offset);
+  }
+
+  ShmReadStatus          wait_for_next(int timeout_ms);
+  void                   skip_to_oldest();
+  shm_detail::RingSlot&  slot_for(std::uint64_t seq) const { return slots_[(seq - 1) & mask_]; }
+
+  shm_detail::RingHeader* header_{nullptr};
+  shm_detail::RingSlot*   slots_{nullptr};
+  std::size_t             bytes_{0};
+  std::uint64_t           mask_{0};
+  std::uint64_t           next_{1};       // Sequence number of the next frame to read
+  std::uint64_t           overruns_{0};   // Times the writer lapped this reader
+  SharedFrame             frame_{};       // Validated copy handed to the callback (readings past lidar_count stale)
+};
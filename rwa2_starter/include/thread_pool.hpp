@@ -0,0 +1,82 @@
+/**
+ * @file    thread_pool.hpp
+ * @author  Chris Collins
+ * @brief   Persistent worker threads that run a batch of indexed tasks; the calling thread takes part
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads, started once and reused by every run(), so per-frame parallel work pays no
+ *        thread creation
+ *
+ * run() hands out task indices dynamically. Which thread runs a task is not deterministic; callers that need
+ * deterministic results write each task's output to its own slot. One run() at a time: the pool is driven from a
+ * single thread.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Start threads - 1 workers (the calling thread is the last one)
+   *
+   * @param threads Total threads, including the caller; 0 or 1 runs every task on the caller
+   */
+  explicit ThreadPool(std::size_t threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&)            = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  std::size_t size() const { return workers_.size() + 1; }
+
+  /**
+   * @brief Call fn(task) for every task in [0, tasks) across the pool and return once all have finished
+   *
+   * @tparam Fn   Callable taking std::size_t; called concurrently
+   * @param tasks
+   * @param fn
+   * @throws The first exception thrown by fn, after every task has finished
+   */
+  template <typename Fn>
+  void run(std::size_t tasks, Fn&& fn) {
+    using Callable = std::remove_reference_t<Fn>;
+    run_tasks(tasks, [](void* context, std::size_t task) { (*static_cast<Callable*>(context))(task); },
+              const_cast<void*>(static_cast<const void*>(&fn)));
+  }
+
+ private:
+  using TaskFn = void (*)(void*, std::size_t);  // Type-erased task, no allocation per run()
+
+  void run_tasks(std::size_t tasks, TaskFn fn, void* context);
+  void worker_loop();
+  void work();
+
+  std::vector<std::thread> workers_;
+
+  std::mutex               mutex_;  // Guards the members below, except next_
+  std::condition_variable  wake_;
+  std::condition_variable  done_;
+  TaskFn                   fn_{nullptr};
+  void*                    context_{nullptr};
+  std::size_t              tasks_{0};
+  std::size_t              busy_workers_{0};  // Workers still inside the current run
+  std::uint64_t            generation_{0};    // Incremented per run so each worker joins it once
+  bool                     stop_{false};
+  std::exception_ptr       error_;
+  std::atomic<std::size_t> next_{0};  // Next unclaimed task
+};
@@ -0,0 +1,75 @@
+/**
+ * @file    ultrasonic_sensor.hpp
+ * @author  Chris Collins
+ * @brief   Ultrasonic range sensor as a self-contained sensor plugin: reading, result, validation, NEAR/CLEAR
+ *          classification, summary and simulation all live here, so adding it needs no change to the core
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <iomanip>
+#include <ostream>
+#include <random>
+
+// Ultrasonic configuration constants
+constexpr double ultrasonic_min_range{0.02};      // Readings below this are echo dropouts [m]
+constexpr double ultrasonic_max_range{4.0};       // Readings above this are out of range [m]
+constexpr double ultrasonic_near_threshold{0.5};  // NEAR at or below this range [m]
+
+/**
+ * @brief Processed ultrasonic result for one timestamp
+ *
+ */
+struct UltrasonicResult {
+  int    timestamp;
+  double range;  // Raw range [m]
+  bool   near;   // range <= ultrasonic_near_threshold
+  bool   valid;  // range within [ultrasonic_min_range, ultrasonic_max_range]
+};
+
+struct UltrasonicSensor {
+  using Reading = double;  // Range [m]
+  using Result  = UltrasonicResult;
+  static constexpr const char* name{"Sonar"};
+
+  static Result process(int timestamp, Reading range) {
+    return {timestamp, range, range <= ultrasonic_near_threshold,
+            ultrasonic_min_range <= range && range <= ultrasonic_max_range};
+  }
+  static bool valid(const Result& result) { return result.valid; }
+
+  /**
+   * @brief NEAR detections and average valid range over the run
+   *
+   */
+  struct Summary {
+    void add(const Result& result) {
+      if (!result.valid) { return; }
+      near_count += result.near ? 1 : 0;
+      range_total += result.range;
+      ++valid_count;
+    }
+    void print(std::ostream& out) const {
+      out << ", Near: " << near_count << ", Avg Range: " << std::fixed << std::setprecision(2)
+          << (valid_count == 0 ? 0.0 : range_total / valid_count) << "m";
+    }
+
+    int    near_count{0};
+    int    valid_count{0};
+    double range_total{0.0};
+  };
+
+  /**
+   * @brief Simulated range, including occasional dropouts and out-of-range echoes
+   *
+   */
+  template <typename Gen>
+  static Reading simulate(Gen& gen) {
+    return std::uniform_real_distribution<double>{0.0, ultrasonic_max_range * 1.05}(gen);
+  }
+};
@@ -0,0 +1,129 @@
+/**
+ * @file    voxel_grid.hpp
+ * @author  Chris Collins
+ * @brief   Voxel-grid downsampling of accumulated LIDAR point clouds: points are hashed into square cells with an
+ *          open-addressing table and every occupied cell is replaced by the centroid of its points
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include "lidar_geometry.hpp"
+#include "sensor_types.hpp"
+#include "thread_pool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace voxel_detail {
+
+/**
+ * @brief Accumulated points of one occupied cell
+ *
+ */
+struct VoxelCell {
+  std::uint64_t key;    // Packed (ix, iy) cell index
+  double        sum_x;  // Sum of point x [m]
+  double        sum_y;  // Sum of point y [m]
+  std::uint32_t count;  // Points in the cell, 0 marks an empty slot
+};
+
+/**
+ * @brief Open-addressing (linear probing) table from cell key to VoxelCell. clear() keeps the slot array, so a
+ *        table reused across frames only allocates when a frame occupies more cells than any frame before it.
+ *
+ */
+class VoxelTable {
+ public:
+  void insert(std::uint64_t key, std::uint64_t hash, double x, double y);
+  void clear();
+
+  std::size_t size() const { return used_.size(); }
+
+  /**
+   * @brief Call fn(const VoxelCell&) for every occupied cell in insertion order
+   *
+   */
+  template <typename Fn>
+  void for_each(Fn&& fn) const {
+    for (const std::uint32_t slot : used_) { fn(slots_[slot]); }
+  }
+
+ private:
+  void grow();
+
+  std::vector<VoxelCell>     slots_{};  // Power-of-two size
+  std::vector<std::uint32_t> used_{};   // Occupied slot indices in insertion order
+};
+
+}  // namespace voxel_detail
+
+/**
+ * @brief Voxel-grid downsampler. Points are added in batches and downsample() emits one centroid per occupied cell.
+ *
+ * With more than one partition, cells are split between partitions by a hash of their key, so each partition owns
+ * a disjoint set of cells. Batches of at least voxel_parallel_min_points are bucketed by partition once (a counting
+ * pass over the hashes) and each partition's bucket is inserted by a persistent worker with no locking or merge
+ * step. Output order depends only on the partition count, not on thread timing.
+ */
+class VoxelGrid {
+ public:
+  /**
+   * @brief Create an empty grid
+   *
+   * @param cell_size  Voxel edge length [m]
+   * @param partitions Number of spatial partitions / insertion threads (1 = serial)
+   * @throws std::invalid_argument if cell_size <= 0 or partitions == 0
+   */
+  explicit VoxelGrid(double cell_size = voxel_cell_size, std::size_t partitions = 1);
+
+  /**
+   * @brief Add a batch of points
+   *
+   * @param x     Point x coordinates [m]
+   * @param y     Point y coordinates [m]
+   * @param count Number of points
+   */
+  void add(const double* x, const double* y, std::size_t count);
+
+  /**
+   * @brief Add every point of a cloud
+   *
+   * @param cloud
+   */
+  void add(const PointCloud& cloud) { add(cloud.x.data(), cloud.y.data(), cloud.size()); }
+
+  /**
+   * @brief Write one centroid per occupied cell to out (out's capacity is reused)
+   *
+   * @param out Downsampled cloud, timestamp is left unchanged
+   */
+  void downsample(PointCloud& out) const;
+
+  /**
+   * @brief Remove every point, keeping allocated storage for the next frame
+   *
+   */
+  void clear();
+
+  std::size_t cell_count() const;
+  std::size_t point_count() const { return points_; }
+  double      cell_size() const { return cell_size_; }
+  std::size_t partitions() const { return tables_.size(); }
+
+ private:
+  double                                cell_size_;
+  double                                inv_cell_size_;
+  std::vector<voxel_detail::VoxelTable> tables_;     // One per partition
+  std::unique_ptr<ThreadPool>           pool_;       // One thread per partition (none when serial)
+  std::vector<std::uint64_t>            keys_{};     // Cell keys of the current batch
+  std::vector<std::uint64_t>            hashes_{};   // Cell hashes of the current batch
+  std::vector<std::uint32_t>            order_{};    // Batch indices grouped by partition, in batch order
+  std::vector<std::size_t>              offsets_{};  // Start of each partition's group in order_ (partitions + 1)
+  std::size_t                           points_{0};  // Points added since the last clear()
+};
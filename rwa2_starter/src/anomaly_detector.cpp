@@ -0,0 +1,182 @@
+/**
+ * @file    anomaly_detector.cpp
+ * @author  Chris Collins
+ * @brief   Rolling-window z-score and median/MAD anomaly detector definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "anomaly_detector.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double min_spread{1e-9};     // Floor on std/MAD so a flat history does not divide by zero
+constexpr double mad_scale{0.6745};    // Makes MAD scores comparable to z-scores for normal data
+constexpr double pi{3.14159265358979323846};
+
+// P(|T| < t) for Student's t with an integer number of degrees of freedom (Abramowitz & Stegun 26.7.3-26.7.4)
+double student_t_inside(double t, std::size_t dof) {
+  const double theta = std::atan(t / std::sqrt(static_cast<double>(dof)));
+  const double c2    = std::cos(theta) * std::cos(theta);
+  double       term{1.0};
+  double       sum{1.0};
+  if (dof % 2 == 0) {
+    for (std::size_t k{2}; k < dof; k += 2) {  // 1 + 1/2 c^2 + 1*3/(2*4) c^4 + ...
+      term *= c2 * static_cast<double>(k - 1) / static_cast<double>(k);
+      sum  += term;
+    }
+    return std::sin(theta) * sum;
+  }
+  if (dof == 1) { return 2.0 * theta / pi; }
+  for (std::size_t k{3}; k < dof; k += 2) {  // 1 + 2/3 c^2 + 2*4/(3*5) c^4 + ...
+    term *= c2 * static_cast<double>(k - 1) / static_cast<double>(k);
+    sum  += term;
+  }
+  return 2.0 / pi * (theta + std::sin(theta) * std::cos(theta) * sum);
+}
+
+// Z-score threshold with the false-alarm rate that threshold has for normal data, given n samples of history: the
+// score of a new sample against a sample mean and std is distributed as t(n - 1) * sqrt(1 + 1/n), so short
+// histories need a much larger threshold
+double small_sample_threshold(double threshold, std::size_t n) {
+  const double tail = std::erfc(threshold / std::sqrt(2.0));  // Two-sided tail of the normal threshold
+  const std::size_t dof{n - 1};
+  double lo{0.0};
+  double hi{std::max(threshold, 1.0)};
+  while (1.0 - student_t_inside(hi, dof) > tail && hi < 1e12) { hi *= 2.0; }
+  for (int i{0}; i < 100; ++i) {  // Bisection on the t quantile
+    const double mid = 0.5 * (lo + hi);
+    if (1.0 - student_t_inside(mid, dof) > tail) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return hi * std::sqrt(1.0 + 1.0 / static_cast<double>(n));
+}
+}  // namespace
+
+AnomalyDetector::AnomalyDetector(std::size_t num_streams, const AnomalyConfig& config)
+    : num_streams_{num_streams},
+      config_{config},
+      history_(std::max<std::size_t>(config.window, 1) * num_streams, 0.0),
+      sum_(num_streams, 0.0),
+      sum_sq_(num_streams, 0.0),
+      scores_(num_streams, 0.0),
+      flags_(num_streams, 0),
+      scratch_(std::max<std::size_t>(config.window, 1), 0.0),
+      thresholds_(std::max<std::size_t>(config.window, 1) + 1, config.threshold) {
+  config_.window      = std::max<std::size_t>(config_.window, 1);
+  config_.min_history = std::clamp<std::size_t>(config_.min_history, std::min<std::size_t>(2, config_.window),
+                                                config_.window);  // Sample variance needs two samples
+  if (config_.method == AnomalyMethod::ZScore) {
+    for (std::size_t n{std::max<std::size_t>(config_.min_history, 2)}; n <= config_.window; ++n) {
+      thresholds_[n] = small_sample_threshold(config_.threshold, n);
+    }
+  }
+}
+
+std::size_t AnomalyDetector::update(int timestamp, const double* values, std::vector<AnomalyEvent>& flagged) {
+  if (filled_ >= config_.min_history) {
+    if (config_.method == AnomalyMethod::ZScore) {
+      score_zscore(values);
+    } else {
+      score_mad(values);
+    }
+  } else {
+    std::fill(scores_.begin(), scores_.end(), 0.0);
+  }
+
+  // Branch-free flag pass over all streams, then a sparse pass to emit only the flagged ones
+  const double threshold{thresholds_[filled_]};
+  std::size_t  flagged_count{0};
+  for (std::size_t s{0}; s < num_streams_; ++s) {
+    flags_[s] = static_cast<std::uint8_t>(scores_[s] > threshold);
+    flagged_count += flags_[s];
+  }
+  if (flagged_count != 0) {
+    for (std::size_t s{0}; s < num_streams_; ++s) {
+      if (flags_[s]) { flagged.push_back({timestamp, s, scores_[s]}); }
+    }
+  }
+
+  push_history(values);
+  return flagged_count;
+}
+
+std::size_t AnomalyDetector::update_batch(const int* timestamps, const double* values, std::size_t num_frames,
+                                          std::vector<AnomalyEvent>& flagged) {
+  std::size_t total{0};
+  for (std::size_t f{0}; f < num_frames; ++f) {
+    total += update(timestamps[f], values + f * num_streams_, flagged);
+  }
+  return total;
+}
+
+void AnomalyDetector::score_zscore(const double* values) {
+  const double inv_n{1.0 / static_cast<double>(filled_)};
+  const double inv_dof{filled_ > 1 ? 1.0 / static_cast<double>(filled_ - 1) : 0.0};  // Sample variance: n - 1
+  for (std::size_t s{0}; s < num_streams_; ++s) {  // Contiguous over streams: vectorizes
+    const double mean     = sum_[s] * inv_n;
+    const double variance = std::max((sum_sq_[s] - sum_[s] * mean) * inv_dof, 0.0);
+    const double spread   = std::max(std::sqrt(variance), min_spread);
+    scores_[s]            = std::fabs(values[s] - mean) / spread;
+  }
+}
+
+void AnomalyDetector::score_mad(const double* values) {
+  const auto mid = static_cast<std::ptrdiff_t>(filled_ / 2);
+  for (std::size_t s{0}; s < num_streams_; ++s) {
+    for (std::size_t slot{0}; slot < filled_; ++slot) {  // Gather this stream's window
+      scratch_[slot] = history_[slot * num_streams_ + s];
+    }
+    const auto first = scratch_.begin();
+    const auto last  = first + static_cast<std::ptrdiff_t>(filled_);
+    std::nth_element(first, first + mid, last);
+    const double median = scratch_[static_cast<std::size_t>(mid)];
+
+    for (auto it = first; it != last; ++it) { *it = std::fabs(*it - median); }
+    std::nth_element(first, first + mid, last);
+    const double mad = std::max(scratch_[static_cast<std::size_t>(mid)], min_spread);
+
+    scores_[s] = mad_scale * std::fabs(values[s] - median) / mad;
+  }
+}
+
+void AnomalyDetector::push_history(const double* values) {
+  double* slot = &history_[head_ * num_streams_];
+
+  if (config_.method == AnomalyMethod::ZScore) {
+    if (filled_ == config_.window) {  // Window full: drop the oldest sample from the running sums
+      for (std::size_t s{0}; s < num_streams_; ++s) {
+        sum_[s]    -= slot[s];
+        sum_sq_[s] -= slot[s] * slot[s];
+      }
+    }
+    for (std::size_t s{0}; s < num_streams_; ++s) {
+      sum_[s]    += values[s];
+      sum_sq_[s] += values[s] * values[s];
+    }
+  }
+  std::copy(values, values + num_streams_, slot);
+
+  if (filled_ < config_.window) { ++filled_; }
+  head_ = (head_ + 1) % config_.window;
+
+  // Re-sum once per ring wrap so add/subtract rounding error in the running sums cannot accumulate
+  if (head_ == 0 && config_.method == AnomalyMethod::ZScore) {
+    std::fill(sum_.begin(), sum_.end(), 0.0);
+    std::fill(sum_sq_.begin(), sum_sq_.end(), 0.0);
+    for (std::size_t w{0}; w < filled_; ++w) {
+      const double* row = &history_[w * num_streams_];
+      for (std::size_t s{0}; s < num_streams_; ++s) {
+        sum_[s]    += row[s];
+        sum_sq_[s] += row[s] * row[s];
+      }
+    }
+  }
+}
@@ -0,0 +1,217 @@
+/**
+ * @file    async_logger.cpp
+ * @author  Chris Collins
+ * @brief   Asynchronous logger definitions: ring back-pressure, format parsing and the background writer
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "async_logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+
+namespace {
+std::atomic<std::uint64_t> next_logger_id{1};  // 0 marks a thread that has no ring yet
+
+constexpr auto writer_poll_interval = std::chrono::milliseconds{1};  // Background drain period when idle
+
+std::size_t ring_words_for(std::size_t bytes) {
+  std::size_t words{64};
+  while (words * sizeof(std::uint64_t) < bytes) { words *= 2; }  // Power of two so positions wrap with a mask
+  return words;
+}
+
+void append_number(std::string& text, std::uint64_t tag_type, std::uint64_t payload, int precision) {
+  char buffer[64];
+  int  length{0};
+  if (tag_type == log_detail::arg_int) {
+    std::int64_t value{0};
+    std::memcpy(&value, &payload, sizeof(value));
+    length = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value));
+  } else {
+    double value{0.0};
+    std::memcpy(&value, &payload, sizeof(value));
+    length = precision < 0 ? std::snprintf(buffer, sizeof(buffer), "%g", value)
+                           : std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+  }
+  text.append(buffer, static_cast<std::size_t>(std::max(0, std::min(length, static_cast<int>(sizeof(buffer)) - 1))));
+}
+}  // namespace
+
+// ========================================================================
+// LogRing
+// ========================================================================
+
+log_detail::LogRing::LogRing(std::size_t words)
+    : capacity_{words}, mask_{words - 1}, data_{std::make_unique<std::uint64_t[]>(words)} {}
+
+void log_detail::LogRing::wait_for_space(std::size_t words) {
+  if (words > capacity_ / 2) { throw std::length_error{"log record larger than half the log ring"}; }
+  cached_tail_ = tail_.load(std::memory_order_acquire);
+  if (capacity_ - static_cast<std::size_t>(pending_ - cached_tail_) >= words) { return; }
+  stalls_.fetch_add(1, std::memory_order_relaxed);
+  while (capacity_ - static_cast<std::size_t>(pending_ - cached_tail_) < words) {  // Back-pressure: never drop
+    std::this_thread::yield();
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+  }
+}
+
+// ========================================================================
+// AsyncLogger
+// ========================================================================
+
+AsyncLogger::AsyncLogger(std::ostream& out, std::size_t ring_bytes)
+    : out_{out}, ring_words_{ring_words_for(ring_bytes)}, id_{next_logger_id.fetch_add(1)} {
+  for (auto& every_n : sample_every_) { every_n.store(1, std::memory_order_relaxed); }
+  writer_ = std::thread{&AsyncLogger::run, this};
+}
+
+AsyncLogger::~AsyncLogger() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stop_ = true;
+  }
+  wake_.notify_one();
+  writer_.join();
+}
+
+LogFormatId AsyncLogger::define(const std::string& pattern) {
+  std::vector<Segment> segments;
+  std::string          literal;
+  for (std::size_t i{0}; i < pattern.size(); ++i) {
+    if (pattern[i] != '{') {
+      literal += pattern[i];
+      continue;
+    }
+    const std::size_t close = pattern.find('}', i);
+    if (close == std::string::npos) { throw std::invalid_argument{"unterminated placeholder in '" + pattern + "'"}; }
+    const std::string spec = pattern.substr(i + 1, close - i - 1);
+    int               precision{-1};
+    if (!spec.empty()) {
+      if (spec[0] != '.' || spec.size() < 2 || spec.find_first_not_of("0123456789", 1) != std::string::npos) {
+        throw std::invalid_argument{"malformed placeholder '{" + spec + "}' in '" + pattern + "'"};
+      }
+      precision = std::stoi(spec.substr(1));
+    }
+    segments.push_back(Segment{literal, precision, true});
+    literal.clear();
+    i = close;
+  }
+  if (!literal.empty()) { segments.push_back(Segment{literal, -1, false}); }
+
+  std::lock_guard<std::mutex> lock{mutex_};
+  formats_.push_back(std::move(segments));
+  return static_cast<LogFormatId>(formats_.size() - 1);
+}
+
+void AsyncLogger::set_sample_every(std::size_t category, std::uint32_t every_n) {
+  if (category >= log_max_categories) { throw std::out_of_range{"log category out of range"}; }
+  sample_every_[category].store(every_n, std::memory_order_relaxed);
+}
+
+void AsyncLogger::flush() {
+  std::unique_lock<std::mutex>                                lock{mutex_};
+  std::vector<std::pair<const log_detail::LogRing*, std::uint64_t>> targets;
+  targets.reserve(rings_.size());
+  for (const auto& entry : rings_) { targets.emplace_back(entry.second.get(), entry.second->head()); }
+  flush_requested_ = true;
+  wake_.notify_one();
+  drained_.wait(lock, [&targets] {
+    for (const auto& target : targets) {
+      if (target.first->tail() < target.second) { return false; }
+    }
+    return true;
+  });
+}
+
+std::uint64_t AsyncLogger::stalls() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  std::uint64_t               total{0};
+  for (const auto& entry : rings_) { total += entry.second->stalls(); }
+  return total;
+}
+
+log_detail::LogRing& AsyncLogger::register_thread() {
+  std::lock_guard<std::mutex> lock{mutex_};
+  const std::thread::id       self = std::this_thread::get_id();
+  for (const auto& entry : rings_) {
+    if (entry.first == self) { return *entry.second; }
+  }
+  rings_.emplace_back(self, std::make_unique<log_detail::LogRing>(ring_words_));
+  return *rings_.back().second;
+}
+
+void AsyncLogger::run() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  for (;;) {
+    wake_.wait_for(lock, writer_poll_interval, [this] { return stop_ || flush_requested_; });
+    const bool stopping = stop_;
+    flush_requested_    = false;
+    drain();  // Holds the lock: rings and formats cannot change under the pass
+    drained_.notify_all();
+    if (stopping) { return; }
+  }
+}
+
+bool AsyncLogger::drain() {
+  std::vector<std::pair<log_detail::LogRing*, std::uint64_t>> released;
+  text_.clear();
+  for (const auto& entry : rings_) {
+    log_detail::LogRing& ring = *entry.second;
+    std::uint64_t        tail = ring.tail();
+    const std::uint64_t  head = ring.head();
+    if (tail == head) { continue; }
+    while (tail < head) {
+      const std::uint64_t* record = ring.at(tail);
+      const auto           format = static_cast<std::uint32_t>(record[0]);
+      const std::size_t    words  = static_cast<std::size_t>(record[0] >> 32);
+      if (format != log_detail::pad_format && format < formats_.size()) {
+        this->format(formats_[format], record + 1, words - 1);
+      }
+      tail += words;
+    }
+    released.emplace_back(&ring, tail);
+  }
+  if (released.empty()) { return false; }
+
+  out_.write(text_.data(), static_cast<std::streamsize>(text_.size()));
+  out_.flush();
+  for (const auto& entry : released) { entry.first->release(entry.second); }  // Space is reused only once written
+  return true;
+}
+
+void AsyncLogger::format(const std::vector<Segment>& segments, const std::uint64_t* args, std::size_t words) {
+  const std::uint64_t* const end = args + words;
+  for (const Segment& segment : segments) {
+    text_ += segment.literal;
+    if (!segment.placeholder || args >= end) { continue; }  // Missing arguments print as nothing
+
+    const std::uint64_t type   = *args & 0xFF;
+    const std::size_t   length = static_cast<std::size_t>(*args >> 8);
+    ++args;
+    switch (type) {
+      case log_detail::arg_int:
+      case log_detail::arg_double:
+        append_number(text_, type, *args++, segment.precision);
+        break;
+      case log_detail::arg_text:
+        text_.append(reinterpret_cast<const char*>(args), length);
+        args += log_detail::words_for(length);
+        break;
+      case log_detail::arg_doubles:
+        for (std::size_t i{0}; i < length; ++i) {
+          if (i != 0) { text_ += ", "; }
+          append_number(text_, log_detail::arg_double, args[i], segment.precision);
+        }
+        args += length;
+        break;
+      default:
+        return;  // Unknown tag: the rest of the record cannot be decoded
+    }
+  }
+}
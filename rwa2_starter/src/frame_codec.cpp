@@ -0,0 +1,82 @@
+/**
+ * @file    frame_codec.cpp
+ * @author  Chris Collins
+ * @brief   Length-prefixed frame encoding definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_codec.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace {
+template <typename T>
+void put(std::vector<unsigned char>& out, const T& value) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void get(const unsigned char*& in, T& value) {
+  std::memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+}
+
+void encode(int timestamp, std::uint64_t acquired_ns, const double* lidar, std::size_t count, int r, int g, int b,
+            double roll, double pitch, double yaw, std::vector<unsigned char>& out) {
+  count = std::min<std::size_t>(count, shm_max_lidar_readings);
+  put(out, static_cast<std::uint32_t>(encoded_frame_bytes(count) - frame_header_bytes));
+  put(out, static_cast<std::int32_t>(timestamp));
+  put(out, static_cast<std::int32_t>(count));
+  put(out, acquired_ns);
+  const auto* bytes = reinterpret_cast<const unsigned char*>(lidar);
+  out.insert(out.end(), bytes, bytes + count * sizeof(double));
+  put(out, static_cast<std::int32_t>(r));
+  put(out, static_cast<std::int32_t>(g));
+  put(out, static_cast<std::int32_t>(b));
+  put(out, roll);
+  put(out, pitch);
+  put(out, yaw);
+}
+}  // namespace
+
+void encode_frame(const TimestampData& data, std::vector<unsigned char>& out) {
+  const auto [r, g, b]          = data.camera_readings;
+  const auto [roll, pitch, yaw] = data.imu_readings;
+  encode(data.timestamp, data.acquired_ns, data.lidar_readings.data(), data.lidar_readings.size(), r, g, b, roll,
+         pitch, yaw, out);
+}
+
+void encode_frame(const SharedFrame& frame, std::vector<unsigned char>& out) {
+  encode(frame.timestamp, frame.acquired_ns, frame.lidar, static_cast<std::size_t>(std::max(frame.lidar_count, 0)),
+         frame.rgb[0], frame.rgb[1], frame.rgb[2], frame.rpy[0], frame.rpy[1], frame.rpy[2], out);
+}
+
+bool decode_frame(const unsigned char* payload, std::size_t bytes, SharedFrame& out) {
+  if (bytes < encoded_frame_bytes(0) - frame_header_bytes) { return false; }
+  std::int32_t  timestamp{0};
+  std::int32_t  count{0};
+  std::uint64_t acquired_ns{0};
+  get(payload, timestamp);
+  get(payload, count);
+  get(payload, acquired_ns);
+  if (count < 0 || count > shm_max_lidar_readings ||
+      bytes != encoded_frame_bytes(static_cast<std::size_t>(count)) - frame_header_bytes) {
+    return false;
+  }
+  out.timestamp   = timestamp;
+  out.lidar_count = count;
+  out.acquired_ns = acquired_ns;
+  std::memcpy(out.lidar, payload, static_cast<std::size_t>(count) * sizeof(double));
+  payload += static_cast<std::size_t>(count) * sizeof(double);
+  std::int32_t rgb[3]{};
+  for (auto& channel : rgb) { get(payload, channel); }
+  std::copy(std::begin(rgb), std::end(rgb), out.rgb);
+  for (auto& angle : out.rpy) { get(payload, angle); }
+  return true;
+}
@@ -0,0 +1,371 @@
+/**
+ * @file    frame_consumers.cpp
+ * @author  Chris Collins
+ * @brief   FrameBus subscriber definitions: console report, summary statistics and anomaly monitor
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_consumers.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+// ========================================================================
+// FrameReport
+// ========================================================================
+
+FrameReport::FrameReport(AsyncLogger& log)
+    : log_{log},
+      frame_format_{log.define("Processing Timestamp: {}\n"
+                               "- LIDAR: [{.2}] \n"
+                               "      Avg: {.2}m, Obstacles: {}, STATUS: {}\n"
+                               "- Camera: RGB({}, {}, {}), Brightness: {.1}, Mode: {}, Status: {}\n"
+                               "- IMU: RPY({.1}, {.1}, {.1}), Total Rotation: {.1} deg, Mode: {}, Status: {}\n")},
+      end_format_{log.define("\n")} {}
+
+void FrameReport::on(const ProcessedFrame& frame) {
+  if (!log_.sampled(log_frame_report, static_cast<std::uint64_t>(frame.timestamp))) { return; }
+  const LidarResult&  lidar  = frame.lidar;
+  const CameraResult& camera = frame.camera;
+  const ImuResult&    imu    = frame.imu;
+
+  // One record per frame: readings are copied into the log ring and formatted by the logger thread
+  log_.log(frame_format_, frame.timestamp,
+           LogSpan{lidar.readings, lidar.count}, lidar.avg_distance, lidar.obstacles, (lidar.valid ? "GOOD" : "POOR"),
+           camera.r, camera.g, camera.b, camera.brightness, (camera.night ? "NIGHT" : "DAY"),
+           (camera.valid ? "GOOD" : "POOR"),
+           imu.roll, imu.pitch, imu.yaw, imu.total_rotation, (imu.stable ? "STABLE" : "UNSTABLE"),
+           (imu.valid ? "GOOD" : "POOR"));
+}
+
+void FrameReport::on(const FrameEnd& end) {
+  if (log_.sampled(log_frame_report, static_cast<std::uint64_t>(end.timestamp))) { log_.log(end_format_); }
+}
+
+void FrameReport::on(const RunComplete&) { log_.flush(); }
+
+// ========================================================================
+// SensorStatistics
+// ========================================================================
+
+SensorStatistics::SensorStatistics()
+    : valid_readings{{"LIDAR", 0}, {"Camera", 0}, {"IMU", 0}},
+      total_readings{{"LIDAR", 0}, {"Camera", 0}, {"IMU", 0}} {}
+
+void SensorStatistics::on(const LidarResult& lidar) {
+  total_readings["LIDAR"]++;
+  if (lidar.valid) { valid_readings["LIDAR"]++; }  // Increment valid LIDAR reading count if status is GOOD
+  total_lidar_avg_distance += lidar.avg_distance;
+  total_obstacles_detected += lidar.obstacles;
+}
+
+void SensorStatistics::on(const CameraResult& camera) {
+  total_readings["Camera"]++;
+  if (camera.valid) { valid_readings["Camera"]++; }  // Increment valid Camera reading count if status is GOOD
+  if (camera.night) {
+    night_mode_count++;
+  } else {
+    day_mode_count++;
+  }
+  total_camera_avg_brightness += camera.brightness;
+}
+
+void SensorStatistics::on(const ImuResult& imu) {
+  total_readings["IMU"]++;
+  if (imu.valid) { valid_readings["IMU"]++; }  // Increment valid IMU reading count if status is GOOD
+  if (imu.stable) {
+    stable_imu_count++;
+  } else {
+    unstable_imu_count++;
+  }
+  total_imu_rotation += imu.total_rotation;
+}
+
+void SensorStatistics::on(const ScanFilterResult& filter) {
+  lidar_beams_repaired += static_cast<int>(filter.repaired);
+  if (filter.repaired != 0) { lidar_scans_repaired++; }
+}
+
+void SensorStatistics::on(const RunComplete& run) {
+  if (run.frames_processed == 0) {
+    std::cout << "=== SUMMARY STATISTICS ===\nNo timestamps processed\n";
+    return;
+  }
+  const double time_steps         = run.frames_processed;
+  const double sum_total_readings = total_readings["Camera"] + total_readings["IMU"] + total_readings["LIDAR"];
+  const double sum_valid_readings = valid_readings["Camera"] + valid_readings["IMU"] + valid_readings["LIDAR"];
+
+  // Print Total Valid and Total Readings Processed, set precision to 2 decimal places for remainder of output
+  std::cout << std::fixed << std::setprecision(2) << "=== SUMMARY STATISTICS ===\n"
+            << "Total Readings Processed: "       << sum_total_readings << '\n'
+            << "Valid Readings: "                 << sum_valid_readings << " ("
+            << (sum_valid_readings / sum_total_readings) * 100.0 << "%) \n\n";
+
+  // Print Sensor Reliability Report (valid vs total readings and % Valid)
+  std::cout << "Sensor Reliability Report:" << '\n'
+            << "- LIDAR:   " << valid_readings["LIDAR"]    << "/" << run.frames_processed << "("
+            << (valid_readings["LIDAR"]  / time_steps) * 100.0 << "%)\n"
+
+            << "- Camera:  " << valid_readings["Camera"]   << "/" << run.frames_processed << "("
+            << (valid_readings["Camera"] / time_steps) * 100.0 << "%)\n"
+
+            << "- IMU:     " << valid_readings["IMU"]      << "/" << run.frames_processed << "("
+            << (valid_readings["IMU"]    / time_steps) * 100.0 << "%)\n\n";
+
+  // Print Operational Statistics: Average and count across timestamps)
+  std::cout << "Operational Statistics: \n"
+            << "Average LIDAR Distance:     " << total_lidar_avg_distance    / time_steps << "m \n"
+            << "Total Obstacles Detected:   " << total_obstacles_detected                 << '\n'
+            << "LIDAR Beams Repaired:       " << lidar_beams_repaired << " (" << lidar_scans_repaired << " scans)\n"
+            << std::setprecision(1)
+            << "Average Camera Brightness:  " << total_camera_avg_brightness / time_steps << '\n'
+            << "   - Day   Mode Detections: " << day_mode_count                           << '\n'
+            << "   - Night Mode Detections: " << night_mode_count                         << '\n'
+            << "Average IMU Total Rotation: " << total_imu_rotation          / time_steps << " deg \n"
+            << "   -   Stable Detections:   " << stable_imu_count                         << '\n'
+            << "   - Unstable Detections:   " << unstable_imu_count                       << '\n';
+}
+
+// ========================================================================
+// AnomalyMonitor
+// ========================================================================
+
+AnomalyMonitor::AnomalyMonitor(const AnomalyConfig& config, AsyncLogger& log)
+    : detector_{anomaly_channel_count, config},
+      log_{log},
+      begin_format_{log.define("- ANOMALY:")},
+      event_format_{log.define(" {}(score {.1})")},
+      end_format_{log.define("\n")} {}
+
+void AnomalyMonitor::on(const ProcessedFrame& frame) {
+  double values[anomaly_channel_count]{};  // Current timestamp values fed to the detector
+  values[anomaly_lidar_channel]      = frame.lidar.avg_distance;
+  values[anomaly_brightness_channel] = frame.camera.brightness;
+  values[anomaly_rotation_channel]   = frame.imu.total_rotation;
+
+  // Score current timestamp against recent history and report any channel that deviates
+  const std::size_t first_new_event{events_.size()};
+  if (detector_.update(frame.timestamp, values, events_) != 0 &&
+      log_.sampled(log_anomalies, static_cast<std::uint64_t>(frame.timestamp))) {
+    log_.log(begin_format_);
+    for (std::size_t e{first_new_event}; e < events_.size(); ++e) {
+      log_.log(event_format_, anomaly_channel_name(events_[e].stream % anomaly_channel_count), events_[e].score);
+    }
+    log_.log(end_format_);
+  }
+}
+
+void AnomalyMonitor::on(const RunComplete&) {
+  // Print flagged timestamp IDs from the anomaly detector
+  std::cout << "Anomalous Frames:           " << events_.size();
+  if (!events_.empty()) {
+    std::cout << " [";
+    for (const auto& event : events_) {
+      std::cout << ' ' << event.timestamp << ':' << anomaly_channel_name(event.stream % anomaly_channel_count);
+    }
+    std::cout << " ]";
+  }
+  std::cout << '\n';
+}
+
+// ========================================================================
+// FrameRecorder
+// ========================================================================
+
+void FrameRecorder::open(const std::string& path) {
+  writer_ = std::make_unique<RecordingWriter>(path);
+  path_   = path;
+}
+
+void FrameRecorder::on(const TimestampData& data) {
+  if (writer_) { writer_->append(data); }
+}
+
+void FrameRecorder::on(const SharedFrame& frame) {
+  if (writer_) { writer_->append(frame); }
+}
+
+void FrameRecorder::on(const RunComplete&) {
+  if (!writer_) { return; }
+  writer_->finish();
+  std::cout << "Recording Written:          " << path_ << " (" << writer_->blocks_written() << " blocks)\n";
+}
+
+// ========================================================================
+// ResultIndexer
+// ========================================================================
+
+void ResultIndexer::on(const ProcessedFrame& frame) {
+  if (!path_.empty()) { table_.append(frame); }
+}
+
+void ResultIndexer::on(const RunComplete&) {
+  if (path_.empty()) { return; }
+  table_.save(path_);
+  std::cout << "Frame Results Written:      " << path_ << " (" << table_.size() << " frames)\n";
+}
+
+// ========================================================================
+// ScanDownsampler
+// ========================================================================
+
+ScanDownsampler::ScanDownsampler(double cell_size, std::size_t partitions, std::size_t frames)
+    : grid_{cell_size, partitions}, frames_per_map_{frames == 0 ? 1 : frames} {}
+
+void ScanDownsampler::on(const PointCloud& scan) {
+  grid_.add(scan);
+  map_.timestamp = scan.timestamp;
+  if (++frames_in_grid_ == frames_per_map_) { flush(); }
+}
+
+void ScanDownsampler::on(const RunComplete&) {
+  if (frames_in_grid_ != 0) { flush(); }  // Partial map from the last scans
+  std::cout << "Voxel Downsampling:         " << points_in_ << " points -> " << points_out_ << " cells ("
+            << maps_ << " maps, " << std::setprecision(2) << grid_.cell_size() << " m voxels)\n";
+}
+
+void ScanDownsampler::flush() {
+  grid_.downsample(map_);
+  points_in_ += grid_.point_count();
+  points_out_ += map_.size();
+  ++maps_;
+  grid_.clear();
+  frames_in_grid_ = 0;
+}
+
+// ========================================================================
+// ScanOdometry
+// ========================================================================
+
+ScanOdometry::ScanOdometry(const IcpConfig& config, const EkfConfig& ekf) : matcher_{config}, ekf_{ekf} {}
+
+void ScanOdometry::on(const PointCloud& scan) {
+  if (matcher_.has_reference()) {
+    const auto      start   = std::chrono::steady_clock::now();
+    const IcpResult result  = matcher_.match(scan);
+    const double    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (result.converged) { pose_ = compose(pose_, result.transform); }  // Chain only motion ICP settled on
+    ++matches_;
+    converged_ += result.converged ? 1 : 0;
+    iterations_ += result.iterations;
+    match_seconds_ += seconds;
+    max_match_seconds_ = std::max(max_match_seconds_, seconds);
+
+    // Unconverged or poorly supported matches (an unsolved match returns the identity) say nothing reliable about
+    // motion: the EKF only predicts through them
+    const auto pairs     = static_cast<double>(result.correspondences);
+    const bool supported = result.correspondences >= icp_min_correspondences &&
+                           pairs >= icp_min_overlap * static_cast<double>(scan.size());
+    ekf_.predict(frame_period);
+    if (result.converged && supported) { ekf_.update_motion(result.transform, frame_period); }
+  }
+  matcher_.set_reference(scan);
+}
+
+void ScanOdometry::on(const ImuResult& imu) {
+  if (imu.valid) { ekf_.update_heading(imu.yaw * 3.14159265358979323846 / 180.0); }
+}
+
+void ScanOdometry::on(const RunComplete&) {
+  std::cout << "Scan Odometry:              " << matches_ << " matches (" << converged_ << " converged)";
+  if (matches_ != 0) {
+    const double count = static_cast<double>(matches_);
+    std::cout << std::fixed << std::setprecision(2) << ", pose (" << pose_.x << " m, " << pose_.y << " m, "
+              << pose_.theta * 180.0 / 3.14159265358979323846 << " deg), " << std::setprecision(1)
+              << static_cast<double>(iterations_) / count << " iterations, " << std::setprecision(3)
+              << match_seconds_ * 1000.0 / count << " ms avg / " << max_match_seconds_ * 1000.0 << " ms max";
+  }
+  std::cout << '\n';
+
+  const Pose2D fused = ekf_.pose();
+  std::cout << std::fixed << std::setprecision(2) << "Fused Pose (EKF):           (" << fused.x << " m, " << fused.y
+            << " m, " << fused.theta * 180.0 / 3.14159265358979323846 << " deg), heading std "
+            << std::sqrt(ekf_.covariance()(2, 2)) * 180.0 / 3.14159265358979323846 << " deg\n";
+}
+
+// ========================================================================
+// SensorHealth
+// ========================================================================
+
+namespace {
+constexpr const char* health_sensor_names[SensorHealth::sensor_count]{"LIDAR", "Camera", "IMU"};
+}  // namespace
+
+SensorHealth::SensorHealth(AsyncLogger& log, const HealthConfig& config)
+    : monitor_{sensor_count, config},
+      log_{log},
+      event_format_{log.define("- HEALTH {}: {} validity {.1}% over {} (threshold {.1}%)\n")} {}
+
+void SensorHealth::record(Sensor sensor, int timestamp, bool valid) {
+  const auto time_ms = static_cast<std::uint64_t>(std::max(timestamp, 0) * frame_period * 1000.0);
+  monitor_.record(sensor, valid, time_ms, pending_);
+}
+
+void SensorHealth::on(const LidarResult& lidar) { record(lidar_sensor, lidar.timestamp, lidar.valid); }
+void SensorHealth::on(const CameraResult& camera) { record(camera_sensor, camera.timestamp, camera.valid); }
+void SensorHealth::on(const ImuResult& imu) { record(imu_sensor, imu.timestamp, imu.valid); }
+
+void SensorHealth::on(const ProcessedFrame& frame) {
+  const bool sampled = log_.sampled(log_health, static_cast<std::uint64_t>(frame.timestamp));
+  for (const auto& event : pending_) {
+    if (sampled) {
+      log_.log(event_format_, (event.raised ? "ALERT" : "OK"), health_sensor_names[event.sensor], event.rate * 100.0,
+               monitor_.config().horizons[event.horizon].name, monitor_.config().threshold * 100.0);
+    }
+    alerts_ += event.raised ? 1 : 0;
+  }
+  pending_.clear();
+}
+
+void SensorHealth::on(const RunComplete&) {
+  const auto& horizons = monitor_.config().horizons;
+  std::cout << "Rolling Validity (";
+  for (std::size_t h{0}; h < horizons.size(); ++h) { std::cout << (h == 0 ? "" : " / ") << horizons[h].name; }
+  std::cout << "): " << alerts_ << " alerts raised\n" << std::fixed << std::setprecision(1);
+  for (std::size_t sensor{0}; sensor < sensor_count; ++sensor) {
+    std::cout << "   - " << std::left << std::setw(7) << health_sensor_names[sensor] << std::right;
+    for (std::size_t h{0}; h < horizons.size(); ++h) {
+      std::cout << (h == 0 ? "" : " / ") << monitor_.rate(sensor, h) * 100.0 << "%";
+    }
+    std::cout << '\n';
+  }
+}
+
+// ========================================================================
+// LatencyTracker
+// ========================================================================
+
+namespace {
+void print_latency(const char* name, const LatencyHistogram& histogram) {
+  auto us = [](std::uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+  std::cout << "   - " << std::left << std::setw(11) << name << std::right << std::fixed << std::setprecision(1)
+            << "p50 " << us(histogram.percentile(0.50)) << " / p90 " << us(histogram.percentile(0.90)) << " / p99 "
+            << us(histogram.percentile(0.99)) << " / max " << us(histogram.max()) << " us\n";
+}
+}  // namespace
+
+void LatencyTracker::on(const FrameTiming& timing) {
+  if (timing.acquired_ns != 0 && timing.acquired_ns <= timing.ingest_ns) {  // Unknown or foreign clock: skip
+    end_to_end_.record(timing.reported_ns - timing.acquired_ns);
+    transport_.record(timing.ingest_ns - timing.acquired_ns);
+  }
+  processing_.record(timing.processed_ns - timing.ingest_ns);
+  reporting_.record(timing.reported_ns - timing.processed_ns);
+}
+
+void LatencyTracker::on(const RunComplete&) {
+  if (processing_.count() == 0) { return; }
+  std::cout << "Frame Latency (" << processing_.count() << " frames, " << cycle_clock_name() << "):\n";
+  if (end_to_end_.count() != 0) {
+    print_latency("End-to-end", end_to_end_);
+    print_latency("Transport", transport_);
+  }
+  print_latency("Processing", processing_);
+  print_latency("Reporting", reporting_);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file    frame_processing.cpp
+ * @author  Chris Collins
+ * @brief   Per-timestamp LIDAR, Camera and IMU processing definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_processing.hpp"
+#include "builtin_sensors.hpp"
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+LidarResult process_lidar(int timestamp, const double* readings, std::size_t count) {
+  LidarResult result{timestamp, readings, count, 0.0, 0, true};
+  if (count == 0) { return result; }
+
+  result.avg_distance = std::accumulate(readings, readings + count, 0.0) / count;  // Average distance
+  for (std::size_t i{0}; i < count; ++i) {
+    if (readings[i] <= obstacle_threshold) { result.obstacles++; }  // Count obstacles within threshold distance
+    if (readings[i] < lidar_min_valid) { result.valid = false; }    // Any reading below min valid -> POOR
+  }
+  return result;
+}
+
+CameraResult process_camera(int timestamp, const CameraData& camera) {
+  const auto [r, g, b]    = camera;          // Unpack RGB values from Camera reading tuple
+  const double brightness = (r + g + b) / 3.0;
+  return {timestamp, r, g, b, brightness,
+          brightness <= day_night_threshold,  // NIGHT mode at or below day/night threshold
+          brightness >= brightness_threshold};  // POOR below brightness threshold
+}
+
+CameraResult process_camera(int timestamp, const ImagePyramid& pyramid, std::size_t level) {
+  const ConstImageView image = pyramid.level(level);
+  if (image.channels != 3) { throw std::invalid_argument{"camera image must be 3-channel RGB"}; }
+  double means[3]{};
+  channel_means(image, means);
+  return process_camera(timestamp, CameraData{static_cast<int>(std::lround(means[0])),
+                                              static_cast<int>(std::lround(means[1])),
+                                              static_cast<int>(std::lround(means[2]))});
+}
+
+ImuResult process_imu(int timestamp, const ImuData& imu) {
+  const auto [roll, pitch, yaw] = imu;  // Unpack Roll, Pitch, Yaw values from IMU reading tuple
+  const bool stable = (std::fabs(roll) < imu_stability_threshold) &&
+                      (std::fabs(pitch) < imu_stability_threshold) &&
+                      (std::fabs(yaw) < imu_stability_threshold);
+  const bool valid = (imu_min_rotation < roll) && (roll < imu_max_rotation) &&
+                     (imu_min_rotation < pitch) && (pitch < imu_max_rotation) &&
+                     (imu_min_rotation < yaw) && (yaw < imu_max_rotation);
+  return {timestamp, roll, pitch, yaw, std::sqrt(roll * roll + pitch * pitch + yaw * yaw), stable, valid};
+}
+
+ProcessedFrame process_frame(int timestamp, const double* lidar, std::size_t lidar_count, const CameraData& camera,
+                             const ImuData& imu) {
+  const LidarScan scan{lidar, lidar_count};
+  return BuiltinSensors::process_into<ProcessedFrame>(timestamp, {scan, camera, imu}, timestamp);
+}
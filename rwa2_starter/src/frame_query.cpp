@@ -0,0 +1,331 @@
+/**
+ * @file    frame_query.cpp
+ * @author  Chris Collins
+ * @brief   Per-frame result table, predicate scans and query language definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_query.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+constexpr char results_magic[8]{'R', 'W', 'A', '2', 'R', 'E', 'S', '\0'};
+
+/**
+ * @brief Evaluate cmp over a column 64 rows at a time, packing results into bit words
+ *
+ */
+template <typename T, typename Cmp>
+RoaringBitmap scan(const std::vector<T>& column, Cmp cmp) {
+  const std::size_t          rows = column.size();
+  std::vector<std::uint64_t> words((rows + 63) / 64, 0);
+  const T*                   data = column.data();
+
+  const std::size_t full_words = rows / 64;
+  for (std::size_t w{0}; w < full_words; ++w) {
+    std::uint64_t word{0};
+    const T*      block = data + w * 64;
+    for (std::size_t j{0}; j < 64; ++j) {  // No branches: comparison result shifted into place
+      word |= static_cast<std::uint64_t>(cmp(block[j])) << j;
+    }
+    words[w] = word;
+  }
+  for (std::size_t row{full_words * 64}; row < rows; ++row) {
+    words[row / 64] |= static_cast<std::uint64_t>(cmp(data[row])) << (row % 64);
+  }
+  return RoaringBitmap::from_words(words.data(), words.size());
+}
+
+template <typename T, typename V>
+RoaringBitmap scan_op(const std::vector<T>& column, CompareOp op, V value) {
+  switch (op) {
+    case CompareOp::Less:         return scan(column, [value](T x) { return x < value; });
+    case CompareOp::LessEqual:    return scan(column, [value](T x) { return x <= value; });
+    case CompareOp::Greater:      return scan(column, [value](T x) { return x > value; });
+    case CompareOp::GreaterEqual: return scan(column, [value](T x) { return x >= value; });
+    case CompareOp::Equal:        return scan(column, [value](T x) { return x == value; });
+    case CompareOp::NotEqual:     return scan(column, [value](T x) { return x != value; });
+  }
+  return {};
+}
+
+template <typename T, typename V>
+RoaringBitmap filter_op(const std::vector<T>& column, CompareOp op, V value, const RoaringBitmap& rows) {
+  const T* data = column.data();
+  switch (op) {
+    case CompareOp::Less:         return rows.filter([data, value](std::uint32_t row) { return data[row] < value; });
+    case CompareOp::LessEqual:    return rows.filter([data, value](std::uint32_t row) { return data[row] <= value; });
+    case CompareOp::Greater:      return rows.filter([data, value](std::uint32_t row) { return data[row] > value; });
+    case CompareOp::GreaterEqual: return rows.filter([data, value](std::uint32_t row) { return data[row] >= value; });
+    case CompareOp::Equal:        return rows.filter([data, value](std::uint32_t row) { return data[row] == value; });
+    case CompareOp::NotEqual:     return rows.filter([data, value](std::uint32_t row) { return data[row] != value; });
+  }
+  return {};
+}
+
+struct FlagName {
+  const char* name;
+  FrameFlag   flag;
+};
+
+constexpr FlagName flag_names[]{
+    {"lidar_good", flag_lidar_good},   {"lidar_poor", flag_lidar_poor}, {"camera_good", flag_camera_good},
+    {"camera_poor", flag_camera_poor}, {"day", flag_day},               {"night", flag_night},
+    {"stable", flag_imu_stable},       {"unstable", flag_imu_unstable}, {"imu_good", flag_imu_good},
+    {"imu_poor", flag_imu_poor}};
+
+struct ColumnName {
+  const char* name;
+  FrameColumn column;
+};
+
+constexpr ColumnName column_names[]{{"t", column_timestamp},
+                                    {"lidar_avg", column_lidar_avg},
+                                    {"obstacles", column_obstacles},
+                                    {"brightness", column_brightness},
+                                    {"rotation", column_rotation}};
+
+template <typename T>
+void write_column(std::ofstream& out, const std::vector<T>& column) {
+  out.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(column.size() * sizeof(T)));
+}
+
+template <typename T>
+void read_column(std::ifstream& in, std::vector<T>& column, std::size_t rows) {
+  column.resize(rows);
+  in.read(reinterpret_cast<char*>(column.data()), static_cast<std::streamsize>(rows * sizeof(T)));
+}
+
+/**
+ * @brief One parsed query term: a flag or a comparison, optionally negated
+ *
+ */
+struct QueryTerm {
+  bool        negate{false};
+  bool        is_flag{false};
+  FrameFlag   flag{};
+  FrameColumn column{};
+  CompareOp   op{};
+  double      value{0.0};
+};
+
+QueryTerm parse_term(const std::string& term) {
+  QueryTerm         parsed{};
+  parsed.negate          = !term.empty() && term[0] == '!';
+  const std::string name = parsed.negate ? term.substr(1) : term;
+
+  for (const auto& entry : flag_names) {
+    if (name == entry.name) {
+      parsed.is_flag = true;
+      parsed.flag    = entry.flag;
+      return parsed;
+    }
+  }
+
+  // Comparison: <column><op><value>
+  const std::size_t op_pos = name.find_first_of("<>=!");
+  if (op_pos == std::string::npos || op_pos == 0) { throw std::invalid_argument{"unknown query term '" + term + "'"}; }
+  const std::string column_name = name.substr(0, op_pos);
+  const std::size_t value_pos   = name.find_first_not_of("<>=!", op_pos);
+  const std::string op_text     = name.substr(op_pos, value_pos - op_pos);
+  if (value_pos == std::string::npos) { throw std::invalid_argument{"missing value in '" + term + "'"}; }
+
+  if (op_text == "<") {
+    parsed.op = CompareOp::Less;
+  } else if (op_text == "<=") {
+    parsed.op = CompareOp::LessEqual;
+  } else if (op_text == ">") {
+    parsed.op = CompareOp::Greater;
+  } else if (op_text == ">=") {
+    parsed.op = CompareOp::GreaterEqual;
+  } else if (op_text == "==" || op_text == "=") {
+    parsed.op = CompareOp::Equal;
+  } else if (op_text == "!=") {
+    parsed.op = CompareOp::NotEqual;
+  } else {
+    throw std::invalid_argument{"unknown operator in '" + term + "'"};
+  }
+
+  const std::string value_text = name.substr(value_pos);
+  std::size_t       used{0};
+  try {
+    parsed.value = std::stod(value_text, &used);
+  } catch (const std::logic_error&) {  // Not a number, or out of range
+    used = 0;
+  }
+  if (used == 0 || used != value_text.size()) {
+    throw std::invalid_argument{"invalid value '" + value_text + "' in '" + term + "'"};
+  }
+
+  for (const auto& entry : column_names) {
+    if (column_name == entry.name) {
+      parsed.column = entry.column;
+      return parsed;
+    }
+  }
+  throw std::invalid_argument{"unknown column in '" + term + "'"};
+}
+
+/**
+ * @brief AND of the terms of one group. Flag terms are combined first, straight from the table's bitmaps, and
+ *        comparisons are then evaluated only over the rows still in the group instead of scanning whole columns.
+ *
+ */
+RoaringBitmap evaluate_group(const FrameResultTable& table, std::vector<QueryTerm>& terms) {
+  std::stable_partition(terms.begin(), terms.end(), [](const QueryTerm& term) { return term.is_flag && !term.negate; });
+
+  // Seed with the first term
+  auto          term = terms.begin();
+  RoaringBitmap group;
+  if (term->is_flag && !term->negate) {
+    const RoaringBitmap& first = table.flag(term->flag);
+    ++term;
+    if (term != terms.end() && term->is_flag && !term->negate) {
+      group = first & table.flag(term->flag);  // No copy of the first flag bitmap
+      ++term;
+    } else {
+      group = first;
+    }
+  } else if (term->is_flag) {
+    group = and_not(table.all(), table.flag(term->flag));
+    ++term;
+  } else {
+    const RoaringBitmap rows = table.where(term->column, term->op, term->value);
+    group                    = term->negate ? and_not(table.all(), rows) : rows;
+    ++term;
+  }
+
+  for (; term != terms.end() && !group.empty(); ++term) {
+    if (term->is_flag) {
+      group = term->negate ? and_not(group, table.flag(term->flag)) : group & table.flag(term->flag);
+    } else {
+      const RoaringBitmap rows = table.where(term->column, term->op, term->value, group);
+      group                    = term->negate ? and_not(group, rows) : rows;
+    }
+  }
+  return group;
+}
+}  // namespace
+
+void FrameResultTable::append(const ProcessedFrame& frame) {
+  std::uint16_t bits{0};
+  auto set = [&bits](FrameFlag flag, bool value) { bits |= static_cast<std::uint16_t>(value) << flag; };
+  set(flag_lidar_good, frame.lidar.valid);
+  set(flag_lidar_poor, !frame.lidar.valid);
+  set(flag_camera_good, frame.camera.valid);
+  set(flag_camera_poor, !frame.camera.valid);
+  set(flag_day, !frame.camera.night);
+  set(flag_night, frame.camera.night);
+  set(flag_imu_stable, frame.imu.stable);
+  set(flag_imu_unstable, !frame.imu.stable);
+  set(flag_imu_good, frame.imu.valid);
+  set(flag_imu_poor, !frame.imu.valid);
+
+  append_row(frame.timestamp, static_cast<float>(frame.lidar.avg_distance), static_cast<float>(frame.lidar.obstacles),
+             static_cast<float>(frame.camera.brightness), static_cast<float>(frame.imu.total_rotation), bits);
+}
+
+void FrameResultTable::append_row(int timestamp, float lidar_avg, float obstacles, float brightness, float rotation,
+                                  std::uint16_t flag_bits) {
+  const auto row = static_cast<std::uint32_t>(timestamps_.size());
+  timestamps_.push_back(timestamp);
+  metrics_[0].push_back(lidar_avg);
+  metrics_[1].push_back(obstacles);
+  metrics_[2].push_back(brightness);
+  metrics_[3].push_back(rotation);
+  flag_bits_.push_back(flag_bits);
+  for (std::size_t f{0}; f < frame_flag_count; ++f) {
+    if ((flag_bits >> f) & 1U) { flags_[f].add(row); }  // Rows arrive in order: append fast path
+  }
+}
+
+RoaringBitmap FrameResultTable::where(FrameColumn column, CompareOp op, double value) const {
+  if (column == column_timestamp) { return scan_op(timestamps_, op, value); }
+  return scan_op(metrics_[column - column_lidar_avg], op, static_cast<float>(value));
+}
+
+RoaringBitmap FrameResultTable::where(FrameColumn column, CompareOp op, double value,
+                                      const RoaringBitmap& candidates) const {
+  if (column == column_timestamp) { return filter_op(timestamps_, op, value, candidates); }
+  return filter_op(metrics_[column - column_lidar_avg], op, static_cast<float>(value), candidates);
+}
+
+float FrameResultTable::value(FrameColumn column, std::uint32_t row) const {
+  if (column == column_timestamp) { return static_cast<float>(timestamps_[row]); }
+  return metrics_[column - column_lidar_avg][row];
+}
+
+void FrameResultTable::save(const std::string& path) const {
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  if (!out) { throw std::runtime_error{"cannot create results file '" + path + "'"}; }
+  const std::uint64_t rows = size();
+  out.write(results_magic, sizeof(results_magic));
+  out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+  write_column(out, timestamps_);
+  for (const auto& metric : metrics_) { write_column(out, metric); }
+  write_column(out, flag_bits_);
+  if (!out) { throw std::runtime_error{"failed writing results file '" + path + "'"}; }
+}
+
+FrameResultTable FrameResultTable::load(const std::string& path) {
+  std::ifstream in{path, std::ios::binary};
+  if (!in) { throw std::runtime_error{"cannot open results file '" + path + "'"}; }
+  char          magic[sizeof(results_magic)]{};
+  std::uint64_t rows{0};
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+  if (!in || std::memcmp(magic, results_magic, sizeof(magic)) != 0) {
+    throw std::runtime_error{"'" + path + "' is not a results file"};
+  }
+
+  std::vector<std::int32_t>         timestamps;
+  std::array<std::vector<float>, 4> metrics;
+  std::vector<std::uint16_t>        flag_bits;
+  read_column(in, timestamps, rows);
+  for (auto& metric : metrics) { read_column(in, metric, rows); }
+  read_column(in, flag_bits, rows);
+  if (!in) { throw std::runtime_error{"results file '" + path + "' is truncated"}; }
+
+  FrameResultTable table;
+  table.timestamps_.reserve(rows);
+  for (auto& metric : table.metrics_) { metric.reserve(rows); }
+  table.flag_bits_.reserve(rows);
+  for (std::size_t row{0}; row < rows; ++row) {
+    table.append_row(timestamps[row], metrics[0][row], metrics[1][row], metrics[2][row], metrics[3][row],
+                     flag_bits[row]);
+  }
+  return table;
+}
+
+RoaringBitmap run_query(const FrameResultTable& table, const std::string& query) {
+  std::istringstream     tokens{query};
+  std::string            token;
+  RoaringBitmap          result;  // OR of finished groups
+  std::vector<QueryTerm> group;   // Terms of the current group, ANDed
+
+  auto finish_group = [&table, &result, &group] {
+    if (group.empty()) { return; }
+    RoaringBitmap rows = evaluate_group(table, group);
+    result             = result.empty() ? std::move(rows) : result | rows;
+    group.clear();
+  };
+  while (tokens >> token) {
+    if (token == "or" || token == "OR" || token == "|") {
+      finish_group();
+      continue;
+    }
+    if (token == "and" || token == "AND" || token == "&") { continue; }
+    group.push_back(parse_term(token));
+  }
+  finish_group();
+  return result;
+}
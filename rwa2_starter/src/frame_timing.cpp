@@ -0,0 +1,134 @@
+/**
+ * @file    frame_timing.cpp
+ * @author  Chris Collins
+ * @brief   Monotonic clock, cycle counter calibration and latency histogram definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_timing.hpp"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define RWA2_HAS_TSC 1
+#else
+#define RWA2_HAS_TSC 0
+#endif
+
+namespace {
+constexpr std::uint64_t tsc_calibration_ns{5000000};  // Calibration window [ns]
+
+/**
+ * @brief Cycle counter selection and ticks-to-ns scale, measured once per process
+ *
+ */
+struct CycleCalibration {
+  bool   use_tsc{false};
+  double ns_per_cycle{1.0};
+};
+
+bool invariant_tsc() {
+#if RWA2_HAS_TSC
+  unsigned eax{0}, ebx{0}, ecx{0}, edx{0};
+  if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) { return false; }
+  __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+  return (edx & (1U << 8)) != 0;  // Constant rate across P/C-states
+#else
+  return false;
+#endif
+}
+
+CycleCalibration calibrate() {
+  CycleCalibration calibration{};
+#if RWA2_HAS_TSC
+  if (!invariant_tsc()) { return calibration; }
+  const std::uint64_t start_ns  = monotonic_ns();
+  const std::uint64_t start_tsc = __rdtsc();
+  std::uint64_t       end_ns{start_ns};
+  while (end_ns - start_ns < tsc_calibration_ns) { end_ns = monotonic_ns(); }
+  const std::uint64_t end_tsc = __rdtsc();
+  if (end_tsc > start_tsc) {
+    calibration.use_tsc      = true;
+    calibration.ns_per_cycle = static_cast<double>(end_ns - start_ns) / static_cast<double>(end_tsc - start_tsc);
+  }
+#endif
+  return calibration;
+}
+
+const CycleCalibration& calibration() {
+  static const CycleCalibration instance = calibrate();
+  return instance;
+}
+}  // namespace
+
+std::uint64_t monotonic_ns() {
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<std::uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+std::uint64_t cycle_count() {
+#if RWA2_HAS_TSC
+  if (calibration().use_tsc) { return __rdtsc(); }
+#endif
+  return monotonic_ns();
+}
+
+std::uint64_t cycles_to_ns(std::uint64_t cycles) {
+  const CycleCalibration& c = calibration();
+  return c.use_tsc ? static_cast<std::uint64_t>(static_cast<double>(cycles) * c.ns_per_cycle) : cycles;
+}
+
+void calibrate_cycle_clock() { calibration(); }
+
+const char* cycle_clock_name() { return calibration().use_tsc ? "tsc" : "clock_gettime"; }
+
+// ========================================================================
+// LatencyHistogram
+// ========================================================================
+
+namespace {
+constexpr unsigned      histogram_sub_bits{LatencyHistogram::sub_bits};
+constexpr std::uint64_t histogram_sub_count{1U << histogram_sub_bits};
+
+std::size_t bucket_of(std::uint64_t value) {
+  if (value < histogram_sub_count) { return static_cast<std::size_t>(value); }
+  const unsigned exponent = 63U - static_cast<unsigned>(__builtin_clzll(value));
+  const unsigned shift    = exponent - histogram_sub_bits;
+  return ((static_cast<std::size_t>(shift) + 1) << histogram_sub_bits) +
+         static_cast<std::size_t>((value >> shift) & (histogram_sub_count - 1));
+}
+
+std::uint64_t bucket_upper(std::size_t bucket) {
+  if (bucket < histogram_sub_count) { return bucket; }
+  const std::size_t   shift = (bucket >> histogram_sub_bits) - 1;
+  const std::uint64_t lower = (histogram_sub_count + (bucket & (histogram_sub_count - 1))) << shift;
+  return lower + ((std::uint64_t{1} << shift) - 1);
+}
+}  // namespace
+
+void LatencyHistogram::record(std::uint64_t ns) {
+  ++counts_[bucket_of(ns)];
+  ++count_;
+  sum_ += ns;
+  min_ = std::min(min_, ns);
+  max_ = std::max(max_, ns);
+}
+
+std::uint64_t LatencyHistogram::percentile(double q) const {
+  if (count_ == 0) { return 0; }
+  const auto    rank = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count_)));
+  std::uint64_t seen{0};
+  for (std::size_t bucket{0}; bucket < bucket_count; ++bucket) {
+    seen += counts_[bucket];
+    if (seen >= std::max<std::uint64_t>(rank, 1)) { return std::min(bucket_upper(bucket), max_); }
+  }
+  return max_;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file    health_monitor.cpp
+ * @author  Chris Collins
+ * @brief   Rolling sensor validity rate definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "health_monitor.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+HealthMonitor::HealthMonitor(std::size_t sensors, const HealthConfig& config)
+    : config_{config}, sensors_{sensors}, horizons_{config.horizons.size()} {
+  for (const auto& horizon : config_.horizons) {
+    if (horizon.buckets == 0 || horizon.bucket_ms == 0) {
+      throw std::invalid_argument{"health horizon '" + horizon.name + "' needs buckets and a bucket width"};
+    }
+    offsets_.push_back(buckets_per_sensor_);
+    buckets_per_sensor_ += horizon.buckets;
+  }
+  buckets_.assign(sensors_ * buckets_per_sensor_, Bucket{0, 0});
+  windows_.assign(sensors_ * horizons_, Window{0, 0, 0, false});
+}
+
+void HealthMonitor::record(std::size_t sensor, bool valid, std::uint64_t time_ms, std::vector<HealthEvent>& events) {
+  Bucket* sensor_buckets = &buckets_[sensor * buckets_per_sensor_];
+  for (std::size_t h{0}; h < horizons_; ++h) {
+    const HealthHorizon& horizon = config_.horizons[h];
+    Window&              window  = windows_[index(sensor, h)];
+    Bucket*              ring    = sensor_buckets + offsets_[h];
+
+    // Advance the ring to the bucket of time_ms, expiring the buckets it passes (at most one full ring)
+    const std::uint64_t epoch = time_ms / horizon.bucket_ms;
+    if (epoch > window.epoch) {
+      const std::uint64_t steps = std::min<std::uint64_t>(epoch - window.epoch, horizon.buckets);
+      for (std::uint64_t s{1}; s <= steps; ++s) {
+        Bucket& expired = ring[(window.epoch + s) % horizon.buckets];
+        window.valid_sum -= expired.valid;
+        window.total_sum -= expired.total;
+        expired = Bucket{0, 0};
+      }
+      window.epoch = epoch;
+    }
+
+    Bucket& current = ring[window.epoch % horizon.buckets];
+    current.valid += valid ? 1U : 0U;
+    current.total += 1U;
+    window.valid_sum += valid ? 1U : 0U;
+    window.total_sum += 1U;
+
+    // Threshold crossing with hysteresis, from the running sums only
+    if (window.total_sum < config_.min_samples) { continue; }
+    const double current_rate = static_cast<double>(window.valid_sum) / window.total_sum;
+    if (!window.alerting && current_rate < config_.threshold) {
+      window.alerting = true;
+      events.push_back({sensor, h, current_rate, true, time_ms});
+    } else if (window.alerting && current_rate >= config_.threshold + config_.hysteresis) {
+      window.alerting = false;
+      events.push_back({sensor, h, current_rate, false, time_ms});
+    }
+  }
+}
+
+double HealthMonitor::rate(std::size_t sensor, std::size_t horizon) const {
+  const Window& window = windows_[index(sensor, horizon)];
+  return window.total_sum == 0 ? 1.0 : static_cast<double>(window.valid_sum) / window.total_sum;
+}
+
+std::uint32_t HealthMonitor::samples(std::size_t sensor, std::size_t horizon) const {
+  return windows_[index(sensor, horizon)].total_sum;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file    image_kernels.cpp
+ * @author  Chris Collins
+ * @brief   Color-space conversion and pyramid reduction kernel definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "image_kernels.hpp"
+#include <stdexcept>
+
+namespace {
+// Fixed-point BT.601 coefficients scaled by 2^16 (full range, as used by JPEG)
+constexpr std::int32_t y_r{19595}, y_g{38470}, y_b{7471};     // 0.299, 0.587, 0.114
+constexpr std::int32_t u_r{-11059}, u_g{-21709}, u_b{32768};  // -0.168736, -0.331264, 0.5
+constexpr std::int32_t v_r{32768}, v_g{-27439}, v_b{-5329};   // 0.5, -0.418688, -0.081312
+constexpr std::int32_t round_half{1 << 15};
+constexpr std::int32_t chroma_offset{128 << 16};
+
+inline std::uint8_t clamp_u8(std::int32_t value) {
+  return static_cast<std::uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+void require(bool condition, const char* message) {
+  if (!condition) { throw std::invalid_argument{message}; }
+}
+
+int resolve_end(int row_end, int height) { return row_end < 0 ? height : std::min(row_end, height); }
+
+void box_down(const ConstImageView& src, const ImageView& dst, int row_begin, int row_end) {
+  const int channels = src.channels;
+  for (int y{row_begin}; y < row_end; ++y) {
+    const std::uint8_t* top    = src.row(2 * y);
+    const std::uint8_t* bottom = src.row(2 * y + 1);
+    std::uint8_t*       out    = dst.row(y);
+    for (int x{0}; x < dst.width; ++x) {
+      const int s = 2 * x * channels;  // First source value of the 2x2 block
+      for (int c{0}; c < channels; ++c) {
+        out[x * channels + c] = static_cast<std::uint8_t>(
+            (top[s + c] + top[s + channels + c] + bottom[s + c] + bottom[s + channels + c] + 2) >> 2);
+      }
+    }
+  }
+}
+
+void gaussian_down(const ConstImageView& src, const ImageView& dst, int row_begin, int row_end,
+                   std::int32_t* column_sums) {  // Vertical pass of one output row, src.width * channels values
+  constexpr int weights[5]{1, 4, 6, 4, 1};
+  const int     channels = src.channels;
+  const int     width    = src.width * channels;
+
+  for (int y{row_begin}; y < row_end; ++y) {
+    // Vertical [1 4 6 4 1] over the 5 source rows centred on 2y (+0.5), borders replicated
+    const std::uint8_t* rows[5];
+    for (int k{0}; k < 5; ++k) { rows[k] = src.row(std::min(std::max(2 * y + k - 2, 0), src.height - 1)); }
+    for (int i{0}; i < width; ++i) {
+      column_sums[i] = rows[0][i] + 4 * rows[1][i] + 6 * rows[2][i] + 4 * rows[3][i] + rows[4][i];
+    }
+
+    // Horizontal [1 4 6 4 1] at every second column, total weight 256
+    std::uint8_t* out = dst.row(y);
+    for (int x{0}; x < dst.width; ++x) {
+      for (int c{0}; c < channels; ++c) {
+        std::int32_t sum{0};
+        for (int k{0}; k < 5; ++k) {
+          const int sx = std::min(std::max(2 * x + k - 2, 0), src.width - 1);
+          sum += weights[k] * column_sums[sx * channels + c];
+        }
+        out[x * channels + c] = static_cast<std::uint8_t>((sum + 128) >> 8);
+      }
+    }
+  }
+}
+}  // namespace
+
+void rgb_to_gray(const ConstImageView& rgb, const ImageView& gray, int row_begin, int row_end) {
+  require(rgb.channels == 3 && gray.channels == 1, "rgb_to_gray expects a 3-channel input and 1-channel output");
+  require(rgb.width == gray.width && rgb.height == gray.height, "rgb_to_gray input and output sizes differ");
+  row_end = resolve_end(row_end, rgb.height);
+
+  const int width = rgb.width;  // Local copy: the byte stores below could alias rgb.width, blocking vectorization
+  for (int row{row_begin}; row < row_end; ++row) {
+    const std::uint8_t* in  = rgb.row(row);
+    std::uint8_t*       out = gray.row(row);
+    for (int x{0}; x < width; ++x) {  // Independent per pixel: vectorized by the compiler
+      const std::int32_t r = in[3 * x], g = in[3 * x + 1], b = in[3 * x + 2];
+      out[x]               = static_cast<std::uint8_t>((y_r * r + y_g * g + y_b * b + round_half) >> 16);
+    }
+  }
+}
+
+void rgb_to_yuv(const ConstImageView& rgb, const ImageView& y, const ImageView& u, const ImageView& v,
+                int row_begin, int row_end) {
+  require(rgb.channels == 3 && y.channels == 1 && u.channels == 1 && v.channels == 1,
+          "rgb_to_yuv expects a 3-channel input and 1-channel planes");
+  require(rgb.width == y.width && rgb.width == u.width && rgb.width == v.width && rgb.height == y.height &&
+              rgb.height == u.height && rgb.height == v.height,
+          "rgb_to_yuv input and output sizes differ");
+  row_end = resolve_end(row_end, rgb.height);
+
+  const int width = rgb.width;  // Local copy, as in rgb_to_gray
+  for (int row{row_begin}; row < row_end; ++row) {
+    const std::uint8_t* in    = rgb.row(row);
+    std::uint8_t*       out_y = y.row(row);
+    std::uint8_t*       out_u = u.row(row);
+    std::uint8_t*       out_v = v.row(row);
+    for (int x{0}; x < width; ++x) {
+      const std::int32_t r = in[3 * x], g = in[3 * x + 1], b = in[3 * x + 2];
+      out_y[x]             = static_cast<std::uint8_t>((y_r * r + y_g * g + y_b * b + round_half) >> 16);
+      out_u[x]             = clamp_u8((u_r * r + u_g * g + u_b * b + chroma_offset + round_half) >> 16);
+      out_v[x]             = clamp_u8((v_r * r + v_g * g + v_b * b + chroma_offset + round_half) >> 16);
+    }
+  }
+}
+
+void pyramid_down(const ConstImageView& src, const ImageView& dst, PyramidFilter filter, int row_begin,
+                  int row_end, std::int32_t* scratch) {
+  require(src.channels == dst.channels, "pyramid_down input and output channel counts differ");
+  require(dst.width == pyramid_down_size(src.width) && dst.height == pyramid_down_size(src.height),
+          "pyramid_down output must be half the input size");
+  row_end = resolve_end(row_end, dst.height);
+  if (filter == PyramidFilter::Box) {
+    box_down(src, dst, row_begin, row_end);
+  } else if (scratch != nullptr) {
+    gaussian_down(src, dst, row_begin, row_end, scratch);
+  } else {
+    std::vector<std::int32_t> column_sums(static_cast<std::size_t>(src.width) * static_cast<std::size_t>(src.channels));
+    gaussian_down(src, dst, row_begin, row_end, column_sums.data());
+  }
+}
+
+void channel_means(const ConstImageView& image, double* means) {
+  std::vector<std::uint64_t> sums(static_cast<std::size_t>(image.channels), 0);
+  for (int y{0}; y < image.height; ++y) {
+    const std::uint8_t* in = image.row(y);
+    for (int x{0}; x < image.width; ++x) {
+      for (int c{0}; c < image.channels; ++c) { sums[static_cast<std::size_t>(c)] += in[x * image.channels + c]; }
+    }
+  }
+  const double pixels = static_cast<double>(image.width) * image.height;
+  for (int c{0}; c < image.channels; ++c) {
+    means[c] = pixels == 0.0 ? 0.0 : static_cast<double>(sums[static_cast<std::size_t>(c)]) / pixels;
+  }
+}
+
+ImagePyramid::ImagePyramid(std::size_t threads)
+    : pool_{threads > 1 ? std::make_unique<ThreadPool>(threads) : nullptr}, scratch_(pool_ ? pool_->size() : 1) {}
+
+void ImagePyramid::build(const ConstImageView& base, std::size_t levels, PyramidFilter filter) {
+  base_   = base;
+  levels_ = 0;
+  if (storage_.size() < levels) {
+    storage_.resize(levels);
+    views_.resize(levels);
+  }
+  if (filter == PyramidFilter::Gaussian) {  // Level 0 is the widest source row
+    const std::size_t row_values = static_cast<std::size_t>(std::max(base.width, 0)) *
+                                   static_cast<std::size_t>(std::max(base.channels, 0));
+    for (auto& row : scratch_) { row.resize(std::max(row.size(), row_values)); }  // Keeps capacity across frames
+  }
+
+  ConstImageView src = base;
+  for (std::size_t i{0}; i < levels; ++i) {
+    const int width  = pyramid_down_size(src.width);
+    const int height = pyramid_down_size(src.height);
+    if (width == 0 || height == 0) { break; }
+
+    const std::size_t row_bytes = static_cast<std::size_t>(width) * static_cast<std::size_t>(src.channels);
+    storage_[i].resize(row_bytes * static_cast<std::size_t>(height));  // Keeps capacity across frames
+    views_[i] = ImageView{storage_[i].data(), width, height, src.channels, static_cast<std::ptrdiff_t>(row_bytes)};
+
+    const ImageView dst = views_[i];
+    parallel_rows(height, pool_.get(), [this, &src, &dst, filter](std::size_t chunk, int row_begin, int row_end) {
+      pyramid_down(src, dst, filter, row_begin, row_end, scratch_[chunk].data());
+    });
+    src = dst;
+    ++levels_;
+  }
+}
+
+ConstImageView ImagePyramid::level(std::size_t i) const {
+  if (i == 0 || levels_ == 0) { return base_; }
+  return views_[std::min(i, levels_) - 1];
+}
@@ -0,0 +1,249 @@
+/**
+ * @file    ingest_server.cpp
+ * @author  Chris Collins
+ * @brief   Epoll ingest server and producer client definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "ingest_server.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+constexpr std::uint64_t listener_tag{~std::uint64_t{0}};  // epoll data for the listening socket
+constexpr std::size_t   client_flush_bytes{32 * 1024};    // Client batches frames up to this size per write
+
+std::runtime_error socket_error(const std::string& what) {
+  return std::runtime_error{what + ": " + std::strerror(errno)};
+}
+
+sockaddr_un unix_address(const std::string& path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(address.sun_path)) { throw std::runtime_error{"unix socket path too long: " + path}; }
+  std::copy(path.begin(), path.end(), address.sun_path);
+  return address;
+}
+
+sockaddr_in loopback_address(int port) {
+  sockaddr_in address{};
+  address.sin_family      = AF_INET;
+  address.sin_port        = htons(static_cast<std::uint16_t>(port));
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  return address;
+}
+}  // namespace
+
+// ========================================================================
+// IngestEndpoint
+// ========================================================================
+
+IngestEndpoint IngestEndpoint::parse(const std::string& spec) {
+  IngestEndpoint endpoint{};
+  if (spec.rfind("unix:", 0) == 0) {
+    endpoint.kind = Kind::Unix;
+    endpoint.path = spec.substr(5);
+  } else if (spec.rfind("tcp:", 0) == 0) {
+    endpoint.kind = Kind::Tcp;
+    endpoint.port = std::stoi(spec.substr(4));
+  } else {
+    throw std::invalid_argument{"endpoint must be unix:<path> or tcp:<port>, got '" + spec + "'"};
+  }
+  return endpoint;
+}
+
+// ========================================================================
+// IngestServer
+// ========================================================================
+
+IngestServer::IngestServer(const IngestEndpoint& endpoint) : connections_(ingest_max_connections) {
+  if (endpoint.kind == IngestEndpoint::Kind::Unix) {
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) { throw socket_error("socket(AF_UNIX) failed"); }
+    unix_path_ = endpoint.path;
+    unlink(unix_path_.c_str());  // Remove a socket file left by a previous run
+    const sockaddr_un address = unix_address(unix_path_);
+    if (bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+      ::close(listen_fd_);
+      throw socket_error("bind(" + unix_path_ + ") failed");
+    }
+  } else {
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) { throw socket_error("socket(AF_INET) failed"); }
+    const int reuse{1};
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address = loopback_address(endpoint.port);
+    socklen_t   length  = sizeof(address);
+    if (bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), length) != 0) {
+      ::close(listen_fd_);
+      throw socket_error("bind(127.0.0.1:" + std::to_string(endpoint.port) + ") failed");
+    }
+    getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+  }
+
+  if (listen(listen_fd_, SOMAXCONN) != 0) {
+    ::close(listen_fd_);
+    throw socket_error("listen failed");
+  }
+
+  epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+  epoll_event event{};
+  event.events   = EPOLLIN | EPOLLET;
+  event.data.u64 = listener_tag;
+  if (epoll_fd_ < 0 || epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &event) != 0) {
+    ::close(listen_fd_);
+    if (epoll_fd_ >= 0) { ::close(epoll_fd_); }
+    throw socket_error("epoll setup failed");
+  }
+
+  free_slots_.reserve(ingest_max_connections);
+  for (std::size_t slot{ingest_max_connections}; slot > 0; --slot) { free_slots_.push_back(slot - 1); }
+  readable_.reserve(ingest_max_events);
+}
+
+IngestServer::~IngestServer() {
+  for (auto& conn : connections_) {
+    if (conn.fd >= 0) { ::close(conn.fd); }
+  }
+  if (epoll_fd_ >= 0) { ::close(epoll_fd_); }
+  if (listen_fd_ >= 0) { ::close(listen_fd_); }
+  if (!unix_path_.empty()) { unlink(unix_path_.c_str()); }
+}
+
+int IngestServer::wait_readable(int timeout_ms) {
+  epoll_event events[ingest_max_events];
+  const int   count = epoll_wait(epoll_fd_, events, ingest_max_events, timeout_ms);
+
+  readable_.clear();
+  for (int i{0}; i < count; ++i) {
+    if (events[i].data.u64 == listener_tag) {
+      accept_all();
+    } else {
+      readable_.push_back(static_cast<std::size_t>(events[i].data.u64));  // Includes EPOLLHUP/ERR: read sees EOF
+    }
+  }
+  return static_cast<int>(readable_.size());
+}
+
+void IngestServer::accept_all() {
+  for (;;) {  // Edge-triggered listener: accept until EAGAIN
+    const int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) { return; }
+    if (free_slots_.empty()) {  // At capacity: refuse the producer
+      ::close(fd);
+      continue;
+    }
+
+    const std::size_t slot = free_slots_.back();
+    free_slots_.pop_back();
+    Connection& conn = connections_[slot];
+    conn.fd             = fd;
+    conn.begin          = 0;
+    conn.end            = 0;
+    conn.protocol_error = false;
+    if (conn.buffer.empty()) { conn.buffer.resize(ingest_buffer_bytes); }
+
+    epoll_event event{};
+    event.events   = EPOLLIN | EPOLLRDHUP | EPOLLET;
+    event.data.u64 = slot;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+    ++active_;
+    ++accepted_;
+  }
+}
+
+IngestServer::ReadResult IngestServer::read_some(Connection& conn) {
+  if (conn.fd < 0) { return ReadResult::WouldBlock; }  // Already closed earlier in this poll
+
+  // Move a trailing partial frame to the front so the read has the whole buffer to fill
+  if (conn.begin == conn.end) {
+    conn.begin = conn.end = 0;
+  } else if (conn.begin > 0 && conn.buffer.size() - conn.end < frame_max_payload_bytes + frame_header_bytes) {
+    std::memmove(conn.buffer.data(), conn.buffer.data() + conn.begin, conn.end - conn.begin);
+    conn.end -= conn.begin;
+    conn.begin = 0;
+  }
+
+  const ssize_t bytes = ::read(conn.fd, conn.buffer.data() + conn.end, conn.buffer.size() - conn.end);
+  if (bytes > 0) {
+    conn.end += static_cast<std::size_t>(bytes);
+    return ReadResult::Data;
+  }
+  if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { return ReadResult::WouldBlock; }
+  if (bytes < 0 && errno == EINTR) { return ReadResult::Data; }  // Retry the read
+  return ReadResult::Closed;
+}
+
+void IngestServer::close_connection(Connection& conn) {
+  if (conn.fd < 0) { return; }
+  epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, conn.fd, nullptr);
+  ::close(conn.fd);
+  conn.fd = -1;
+  free_slots_.push_back(static_cast<std::size_t>(&conn - connections_.data()));
+  --active_;
+}
+
+// ========================================================================
+// IngestClient
+// ========================================================================
+
+IngestClient::IngestClient(const IngestEndpoint& endpoint) {
+  int result{-1};
+  if (endpoint.kind == IngestEndpoint::Kind::Unix) {
+    fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const sockaddr_un address = unix_address(endpoint.path);
+    if (fd_ >= 0) { result = connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)); }
+  } else {
+    fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const sockaddr_in address = loopback_address(endpoint.port);
+    if (fd_ >= 0) { result = connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)); }
+  }
+  if (result != 0) {
+    const std::runtime_error error = socket_error("connect to ingest server failed");
+    if (fd_ >= 0) { ::close(fd_); }
+    throw error;
+  }
+  pending_.reserve(client_flush_bytes + frame_header_bytes + frame_max_payload_bytes);
+}
+
+IngestClient::~IngestClient() {
+  if (fd_ < 0) { return; }
+  try {
+    flush();
+  } catch (const std::exception&) {
+    // Server already gone, nothing left to deliver
+  }
+  ::close(fd_);
+}
+
+void IngestClient::send(const TimestampData& data) {
+  encode_frame(data, pending_);
+  if (pending_.size() >= client_flush_bytes) { flush(); }
+}
+
+void IngestClient::flush() {
+  std::size_t sent{0};
+  while (sent < pending_.size()) {
+    const ssize_t bytes = ::send(fd_, pending_.data() + sent, pending_.size() - sent, MSG_NOSIGNAL);
+    if (bytes < 0) {
+      if (errno == EINTR) { continue; }
+      throw socket_error("send to ingest server failed");
+    }
+    sent += static_cast<std::size_t>(bytes);
+  }
+  pending_.clear();
+}
@@ -0,0 +1,47 @@
+/**
+ * @file    lidar_geometry.cpp
+ * @author  Chris Collins
+ * @brief   LIDAR beam trig table and point cloud conversion definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "lidar_geometry.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+constexpr double deg_to_rad{3.14159265358979323846 / 180.0};
+}  // namespace
+
+LidarProjector::LidarProjector(const BeamLayout& layout) : layout_{layout}, cos_(layout.count), sin_(layout.count) {
+  for (std::size_t i{0}; i < layout_.count; ++i) {
+    const double bearing = (layout_.start_angle + static_cast<double>(i) * layout_.angle_increment) * deg_to_rad;
+    cos_[i]              = std::cos(bearing);
+    sin_[i]              = std::sin(bearing);
+  }
+}
+
+void LidarProjector::project(int timestamp, const double* ranges, std::size_t count, PointCloud& out) const {
+  if (count != layout_.count) {
+    throw std::invalid_argument{"scan has " + std::to_string(count) + " readings, beam layout expects " +
+                                std::to_string(layout_.count)};
+  }
+  out.timestamp = timestamp;
+  out.x.resize(count);
+  out.y.resize(count);
+
+  // Independent element-wise multiplies over contiguous arrays: vectorized by the compiler
+  const double* cos_table = cos_.data();
+  const double* sin_table = sin_.data();
+  double*       x         = out.x.data();
+  double*       y         = out.y.data();
+  for (std::size_t i{0}; i < count; ++i) {
+    x[i] = ranges[i] * cos_table[i];
+    y[i] = ranges[i] * sin_table[i];
+  }
+}
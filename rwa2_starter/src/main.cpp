@@ -12,237 +12,262 @@
  */
 
 #include "sensor_types.hpp"
-#include <iomanip>
+#include "async_logger.hpp"
+#include "builtin_sensors.hpp"
+#include "frame_bus.hpp"
+#include "frame_consumers.hpp"
+#include "frame_processing.hpp"
+#include "frame_timing.hpp"
+#include "ingest_server.hpp"
+#include "lidar_geometry.hpp"
+#include "recording.hpp"
+#include "scan_filter.hpp"
+#include "sensor_config.hpp"
+#include "sensor_simulator.hpp"
+#include "shm_transport.hpp"
+#include <algorithm>
+#include <exception>
 #include <iostream>
-#include <numeric>
+#include <optional>
 #include <random>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <thread>
 #include <vector>
-#include <cmath>
 
-int main() {
+int main(int argc, char* argv[]) {
+  // Optional frame source instead of generating frames:
+  //   "--shm <name>"                      frames published by rwa2_producer through shared memory
+  //   "--listen unix:<path>|tcp:<port>"   frames sent by any number of rwa2_producer processes over sockets
+  //   "--replay <file>"                   frames from a recording, optionally filtered by
+  //                                       "--from <t>", "--to <t>" and "--obstacles-only"
+  // and "--record <file>" to write every frame processed to a recording, "--results <file>" to store per-frame
+  // results for rwa2_query, "--report-every <n>" to print only every Nth frame report
+  std::string    shm_name{};
+  std::string    listen_spec{};
+  std::string    replay_path{};
+  std::string    record_path{};
+  std::string    results_path{};
+  RecordingQuery replay_query{};
+  std::uint32_t  report_every{1};
+  auto usage = [&argv] {
+    std::cerr << "Usage: " << argv[0]
+              << " [--shm <name> | --listen unix:<path>|tcp:<port> | --replay <file> [--from <t>] [--to <t>]"
+                 " [--obstacles-only]] [--record <file>] [--results <file>] [--report-every <n>]\n";
+  };
+  for (int arg{1}; arg < argc; ++arg) {
+    const std::string option{argv[arg]};
+    try {
+      if (option == "--shm" && arg + 1 < argc) {
+        shm_name = argv[++arg];
+      } else if (option == "--listen" && arg + 1 < argc) {
+        listen_spec = argv[++arg];
+      } else if (option == "--replay" && arg + 1 < argc) {
+        replay_path = argv[++arg];
+      } else if (option == "--record" && arg + 1 < argc) {
+        record_path = argv[++arg];
+      } else if (option == "--results" && arg + 1 < argc) {
+        results_path = argv[++arg];
+      } else if (option == "--from" && arg + 1 < argc) {
+        replay_query.t_begin = std::stoi(argv[++arg]);
+      } else if (option == "--to" && arg + 1 < argc) {
+        replay_query.t_end = std::stoi(argv[++arg]);
+      } else if (option == "--report-every" && arg + 1 < argc) {
+        report_every = static_cast<std::uint32_t>(std::stoul(argv[++arg]));
+      } else if (option == "--obstacles-only") {
+        replay_query.lidar_max = RecordingQuery::obstacles_only().lidar_max;
+      } else {
+        usage();
+        return 1;
+      }
+    } catch (const std::logic_error&) {  // std::stoi/std::stoul: not a number, or out of range
+      std::cerr << "Error: invalid value '" << argv[arg] << "' for " << option << '\n';
+      usage();
+      return 1;
+    }
+  }
+
   // Storage for all sensor data across timestamps
   std::vector<TimestampData> sensor_readings;
   sensor_readings.reserve(5);
 
-  // Quality tracking variables
-  const std::unordered_map<std::string, int> initial_counts{{"LIDAR", 0},
-                                                            {"Camera", 0},
-                                                            {"IMU", 0}};
-  std::unordered_map<std::string, int> valid_readings{initial_counts};
-  std::unordered_map<std::string, int> total_readings{initial_counts};
-
-  // Variables for calculating summary statistics across timestamps
-  double total_lidar_avg_distance{0.0};   // Total of average LIDAR distances   
-  double total_camera_avg_brightness{0.0};// Total of average Camera brightness 
-  double total_imu_rotation{0.0};         // Total of average IMU rotation      
-  int    total_obstacles_detected{0};     // Total obstacles detected         (Count of LIDAR readings < obstacle_threshold in sensor_types.hpp) 
-  int    day_mode_count{0};               // Count of day mode detections     (Brightness > day_night_threshold in sensor_types.hpp)    
-  int    night_mode_count{0};             // Count of night mode detections   (Brightness <= day_night_threshold in sensor_types.hpp)    
-  int    stable_imu_count{0};             // Count of stable IMU detections   (All Roll, Pitch, Yaw <= imu_stability_threshold in sensor_types.hpp)     
-  int    unstable_imu_count{0};           // Count of unstable IMU detections (All Roll, Pitch, Yaw > imu_stability_threshold in sensor_types.hpp)
-  double sum_valid_readings{0.0};         // Sum of valid readings across all sensors
-  double sum_total_readings{0.0};         // Sum of total readings across all sensors
-
-  // Variables for current timestamp processing
   constexpr int time_steps{5};              // Number of timestamps to simulate
-  std::string   lidar_status{};             // Status string ("GOOD" or "POOR") for LIDAR current timestamp
-  std::string   camera_status{};            // Status string ("GOOD" or "POOR") for Camera current timestamp
-  std::string   camera_lighting_mode{};     // Lighting mode string ("DAY" or "NIGHT") for Camera current timestamp
-  std::string   imu_stability{};            // Stability string ("STABLE" or "UNSTABLE") for IMU current timestamp
-  std::string   imu_status{};               // Status string ("GOOD" or "POOR") for IMU current timestamp
-  double        lidar_avg_distance{0.0};    // Average LIDAR distance for current timestamp
-  double        obstacles_detected{0.0};    // Number of obstacles detected for current timestamp
-  double        avg_camera_brightness {0.0};// Average Camera brightness for current timestamp
-  double        imu_rotation{0.0};          // Total IMU rotation for current timestamp
-
-  std::cout << "=== ROBOT DUAL-SENSOR SYSTEM ===\n\n";
-
-  // ========================================================================
-  // Step 1: Data Generation and Storage
-  // ========================================================================
-
-  // Create random number generator for simulated sensor readings
-  std::random_device rd;
-  std::mt19937 gen{rd()};
-
-  // Define sensor reading distributions
-  std::uniform_real_distribution<double> lidar_distrib{lidar_min_range, lidar_max_range};
-  std::uniform_int_distribution<int>     camera_distrib{rgb_min, rgb_max};  
-  std::uniform_real_distribution<double> imu_distrib{imu_min_rotation, imu_max_rotation};
-
-  for(int i=0; i < time_steps; ++i ){
-    std::vector<double> lidar_readings{};             // Initialize LIDAR measurement vector
-    TimestampData temp;                               // Temporary storage for current timestamp data
-    
-    for(int j{0}; j < lidar_readings_count; ++j){
-      lidar_readings.push_back(lidar_distrib(gen));   // Generate 8 random LIDAR measurements
+  int frames_processed{0};                  // Number of timestamps published to the frame bus
+
+  // Per-frame console output is logged as binary records and formatted on the logger's own thread
+  AsyncLogger frame_log{std::cout};
+  frame_log.set_sample_every(log_frame_report, report_every);
+
+  // The voxel grid and the ICP correspondence search each split work across one thread per core; scans smaller than
+  // icp_parallel_min_points are still matched on one thread
+  const unsigned int worker_threads = std::max(1U, std::thread::hardware_concurrency());
+  IcpConfig          icp_config{};
+  icp_config.threads = worker_threads;
+
+  // Subscribers to raw and processed frames, called in order for every published event.
+  // Add a consumer by appending it here; the processing loop below does not change.
+  auto frame_bus = make_frame_bus(
+      FrameReport{frame_log},                                         // Per-timestamp console report
+      SensorStatistics{},                                             // Validity counters and summary statistics
+      AnomalyMonitor{{anomaly_window, anomaly_min_history,            // Rolling z-score anomaly flags
+                      anomaly_threshold, AnomalyMethod::ZScore},
+                     frame_log},
+      FrameRecorder{},                                                // Optional recording (--record)
+      ResultIndexer{},                                                // Optional per-frame results (--results)
+      ScanDownsampler{voxel_cell_size, worker_threads},               // Voxel-downsampled LIDAR maps
+      ScanOdometry{icp_config},                                       // ICP scan-to-scan odometry and pose EKF
+      SensorHealth{frame_log},                                        // Rolling validity rates and alerts
+      ExtraSensors::Report{std::cout},                                // Validity and summaries of extra sensors
+      LatencyTracker{});                                              // End-to-end and per-stage frame latency
+
+  frame_bus.get<ResultIndexer>().open(results_path);
+  if (!record_path.empty()) {
+    try {
+      frame_bus.get<FrameRecorder>().open(record_path);
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
     }
-
-    std::tuple<int, int, int> camera_readings{        // Get random RGB values for Camera reading
-          camera_distrib(gen),   // Red
-          camera_distrib(gen),   // Green
-          camera_distrib(gen)};  // Blue 
-
-    std::tuple<double, double, double> imu_readings{  // Get random Roll, Pitch, Yaw values for IMU reading
-          imu_distrib(gen),      // Roll
-          imu_distrib(gen),      // Pitch
-          imu_distrib(gen)};     // Yaw 
-
-    temp.lidar_readings  = lidar_readings;            // Store LIDAR, Camera, IMU, and timestamp in temp struct
-    temp.camera_readings = camera_readings;
-    temp.imu_readings    = imu_readings;
-    temp.timestamp       = i;
-    sensor_readings.push_back(temp);                  // Append temp timestamp struct to main storage vector
   }
-  
-  // ========================================================================
-  // Step 2: Data Processing Loop
-  // ========================================================================
-  std::cout << "Generating Sensor Data for " << time_steps <<" Timestamps..." << "\n\n";
-  for (const auto& data : sensor_readings){ // Loop through each timestamp's sensor data with non-copying reference
-
-    // Reset current timestamp processing variables and set default values
-    lidar_avg_distance       = 0;
-    obstacles_detected       = 0;
-    lidar_status             = "GOOD";
-    camera_status            = "GOOD";
-    camera_lighting_mode     = "DAY";
-    imu_status               = "GOOD";
-
-    total_readings["Camera"]++; // Increment total reading counts for each sensor type
-    total_readings["LIDAR"]++;
-    total_readings["IMU"]++;
-
 
-    // ========================================================================
-    // Step 3: Sensor-Specific Processing
-    // ========================================================================
-
-    std::cout << "Processing Timestamp: " << data.timestamp << '\n'; // Print Current Timestamp and 
-    std::cout << std::fixed << std::setprecision(2);                 // Set precision to 2 decimal places for LIDAR and Camera output
-
-    lidar_avg_distance = std::accumulate(data.lidar_readings.begin(), data.lidar_readings.end(), 0.0 ) / 
-                         data.lidar_readings.size() ;   // Calculate average LIDAR distance for current timestamp
-
-    const auto [r, g, b]  = data.camera_readings;       // Unpack RGB values from Camera reading tuple            
-    avg_camera_brightness = (r + g + b) / 3.0;          // Calculate average brightness for current timestamp
-
-    if (avg_camera_brightness <= day_night_threshold){  // Determine if Camera is in DAY or NIGHT mode based on 
-      camera_lighting_mode = "NIGHT";                   // brightness relative to threshold
-      night_mode_count++;                               // Increment night mode detection count
-    } else day_mode_count++;                            // Otherwise keep default DAY mode and increment day mode detection count                
-
-    const auto [roll, pitch, yaw] = data.imu_readings; // Unpack Roll, Pitch, Yaw values from IMU reading tuple
-    imu_rotation                  = pow( pow(roll,2) + pow(pitch,2) + pow(yaw,2), 0.5); // Calculate total rotation for current timestamp
-
-
-    // ========================================================================
-    // Step 4: Quality Assessment and Status Determination
-    // ========================================================================
-    
-
-    // ======================================================
-    // Start Print Lidar Readings, Determine Status and Obstacle Count
-    // ======================================================
-    
-    std::cout << "- LIDAR: [";
-    for (const auto& lidar_reading : data.lidar_readings){             // Loop through LIDAR readings using non-copying reference 
-      
-      // Print LIDAR measurements with comma seperation except last value
-      if (&lidar_reading != &data.lidar_readings.back()){
-               std::cout << lidar_reading << ", ";
-      } else { std::cout << lidar_reading;}                              // Don't print comma after last value
+  std::cout << "=== ROBOT DUAL-SENSOR SYSTEM ===\n\n";
 
-      if (lidar_reading <= obstacle_threshold) {obstacles_detected++;}  // Count obstacles within threshold distance
-      if (lidar_reading < lidar_min_valid)    {lidar_status = "POOR";} // If any reading below min valid, set status to POOR
+  // Each LIDAR scan is copied, bad beams are repaired by the scan filter, and the filtered scan is what gets
+  // processed. Subscribers see the raw frame first and a ScanFilterResult with the repair counts.
+  ScanFilter          scan_filter{};
+  std::vector<double> filtered_scan{};  // Reused for every scan
+  auto filter_scan = [&frame_bus, &scan_filter, &filtered_scan](int timestamp, const double* ranges,
+                                                                std::size_t count) {
+    filtered_scan.assign(ranges, ranges + count);
+    frame_bus.publish(scan_filter.filter(timestamp, filtered_scan.data(), count));
+    return static_cast<const double*>(filtered_scan.data());
+  };
+
+  // LIDAR scans are converted to x/y point clouds and published as PointCloud events. The trig table is rebuilt
+  // only when a source delivers a different number of beams.
+  LidarProjector projector{BeamLayout{lidar_readings_count, lidar_start_angle, lidar_angle_increment}};
+  PointCloud     scan_points{};  // Reused for every scan
+  auto publish_scan = [&frame_bus, &projector, &scan_points](int timestamp, const double* ranges, std::size_t count) {
+    if (count != projector.layout().count) { projector = LidarProjector{BeamLayout::full_circle(count)}; }
+    projector.project(timestamp, ranges, count, scan_points);
+    frame_bus.publish(static_cast<const PointCloud&>(scan_points));
+  };
+
+  // Each frame is stamped on ingest, after processing and after its subscribers ran; the stamps are published as a
+  // FrameTiming event once the frame is finished. Replayed frames keep their recorded acquisition time, which says
+  // nothing about this run's latency, so it is not reported.
+  StageClock stage_clock{};
+  const bool live_source{replay_path.empty()};
+
+  // Processes one frame from any source: the raw frame (TimestampData or SharedFrame) is published and read through
+  // a const reference; only its LIDAR scan is copied, by filter_scan. Extra sensor readings (sensor_config.hpp), when
+  // the source carries them, are processed and published with the built-in results.
+  auto process_readings = [&frame_bus, &frames_processed, &filter_scan, &publish_scan, &stage_clock](
+                              const auto& raw, const double* ranges, std::size_t count, const CameraData& camera,
+                              const ImuData& imu, std::uint64_t acquired_ns, const ExtraSensors::Frame* extra) {
+    stage_clock.start();
+    frame_bus.publish(raw);                                    // Raw frame subscribers
+    const double* lidar = filter_scan(raw.timestamp, ranges, count);
+    publish_scan(raw.timestamp, lidar, count);
+    // Steps 3-4: sensor processing and quality assessment
+    const ProcessedFrame                 processed = process_frame(raw.timestamp, lidar, count, camera, imu);
+    std::optional<ExtraSensors::Results> extra_processed;
+    if (extra != nullptr) { extra_processed = ExtraSensors::process(raw.timestamp, *extra); }
+    const std::uint64_t processed_ns = stage_clock.now_ns();
+    frame_bus.publish_processed(processed);
+    if (extra_processed) { ExtraSensors::publish(*extra_processed, frame_bus); }
+    frame_bus.publish(FrameEnd{raw.timestamp});
+    frame_bus.publish(FrameTiming{raw.timestamp, acquired_ns, stage_clock.anchor_ns(), processed_ns,
+                                  stage_clock.now_ns()});
+    ++frames_processed;
+  };
+
+  // Processes one fixed-layout frame (validated copy of a shared-memory slot, decoded socket frame or replayed frame).
+  // The layout carries no extra sensor readings, so those sensors are left out of the run.
+  auto process_shared_frame = [&process_readings, live_source](const SharedFrame& frame) {
+    process_readings(frame, frame.lidar, static_cast<std::size_t>(frame.lidar_count), frame.camera(), frame.imu(),
+                     live_source ? frame.acquired_ns : 0, nullptr);
+  };
+
+  if (!replay_path.empty()) {
+    // ======================================================================
+    // Recording source: seek to the blocks the index says can match and replay their frames
+    // ======================================================================
+    try {
+      RecordingReader   reader{replay_path};
+      const ReplayStats stats = reader.replay(replay_query, process_shared_frame);
+      frame_log.flush();
+      std::cout << "Replayed " << stats.frames_matched << " of " << reader.frame_count() << " frames from '"
+                << replay_path << "' (" << stats.blocks_read << " blocks read, " << stats.blocks_skipped
+                << " skipped)\n\n";
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
+    }
+  } else if (!listen_spec.empty()) {
+    // ======================================================================
+    // Socket source: ingest frames from producers until every producer disconnects
+    // ======================================================================
+    try {
+      IngestServer server{IngestEndpoint::parse(listen_spec)};
+      std::cout << "Listening for Sensor Data on " << listen_spec;
+      if (server.port() != 0) { std::cout << " (port " << server.port() << ")"; }
+      std::cout << "..." << "\n\n";
+      while (server.total_connections() == 0 || server.active_connections() != 0) {
+        server.poll(process_shared_frame);
+      }
+      if (server.protocol_errors() != 0) {
+        std::cerr << "Warning: " << server.protocol_errors() << " malformed frames dropped\n";
+      }
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
+    }
+  } else if (!shm_name.empty()) {
+    // ======================================================================
+    // Shared-memory source: process a validated copy of each frame in the producer's ring
+    // ======================================================================
+    std::cout << "Reading Sensor Data from shared memory '" << shm_name << "'..." << "\n\n";
+    try {
+      ShmFrameReader reader{shm_name};
+      for (;;) {
+        const ShmReadStatus status = reader.read(process_shared_frame);
+        if (status == ShmReadStatus::Closed) { break; }
+        if (status == ShmReadStatus::Overrun) {
+          std::cerr << "Warning: processor fell behind the producer, frames skipped\n";
+        }
+      }
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
+    }
+  } else {
+    // ======================================================================
+    // Step 1: Data Generation and Storage
+    // ======================================================================
+    SensorSimulator                  simulator{};  // Random LIDAR, Camera and IMU readings within sensor_types.hpp ranges
+    std::mt19937                     extra_gen{std::random_device{}()};
+    std::vector<ExtraSensors::Frame> extra_readings;  // Extra sensor readings, one frame per timestamp
+    for (int i{0}; i < time_steps; ++i) {
+      sensor_readings.push_back(simulator.next(i));  // Append timestamp struct to main storage vector
+      extra_readings.push_back(ExtraSensors::simulate(extra_gen));
+    }
 
+    // ======================================================================
+    // Step 2: Data Processing Loop
+    // ======================================================================
+    std::cout << "Generating Sensor Data for " << time_steps <<" Timestamps..." << "\n\n";
+    for (std::size_t i{0}; i < sensor_readings.size(); ++i) {
+      const TimestampData& data = sensor_readings[i];  // Non-copying reference to this timestamp's sensor data
+      process_readings(data, data.lidar_readings.data(), data.lidar_readings.size(), data.camera_readings,
+                       data.imu_readings, data.acquired_ns, &extra_readings[i]);
     }
-    std::cout << "] \n";
-
-    // =====================================================
-    // END Print LIDAR Readings and Determine Status and Obstacle Count
-    // =====================================================
-  
-    if (lidar_status == "GOOD") {valid_readings["LIDAR"]++;}         // Increment valid LIDAR reading count if status is GOOD
-
-    if (avg_camera_brightness < brightness_threshold){               // If brightness < brightness_threshold,
-       camera_status = "POOR";                                       // set Camera status to POOR, otherwise keep default GOOD                         
-    } else valid_readings["Camera"]++;                               // and Increment valid Camera reading count 
-
-    if ( (abs(roll)  < imu_stability_threshold) &&                   // If all Roll, Pitch, Yaw below stability threshold, 
-         (abs(pitch) < imu_stability_threshold) &&                    
-         (abs(yaw)   < imu_stability_threshold)){     
-      imu_stability = "STABLE";                                      // set IMU stability to STABLE          
-      stable_imu_count++;                                            // and increment stable IMU detection count                 
-    }else{
-      imu_stability = "UNSTABLE";                                    // Otherwise set IMU stability to UNSTABLE
-      unstable_imu_count++;                                          // and increment unstable IMU detection count
-    } 
-
-    if ( (imu_min_rotation < roll)  && (roll  < imu_max_rotation) && // If all Roll, Pitch, Yaw within valid rotation range
-         (imu_min_rotation < pitch) && (pitch < imu_max_rotation) && // increment valid IMU reading and keep default GOOD status
-         (imu_min_rotation < yaw)   && (yaw   < imu_max_rotation) ){
-          valid_readings["IMU"]++;
-    }else imu_status = "POOR";                                       // Otherwise set IMU status to POOR
-
-    // Print LIDAR summary for current timestamp
-    std::cout << "      Avg: " << lidar_avg_distance << "m, Obstacles: " << std::setprecision(0) 
-              << obstacles_detected << ", STATUS: "  << lidar_status     << '\n';
-
-    // Print Current Timestamp Camera measurement, brightness, mode, and status
-    std::cout << std::setprecision(1) << "- Camera: RGB(" << r << ", " << g << ", " << b << "), Brightness: " 
-              << avg_camera_brightness << ", Mode: " << camera_lighting_mode 
-              << ", Status: "          << camera_status << '\n';
-
-    // Print Current Timestamp IMU measurement, total rotation, stability, and status
-    std::cout << "- IMU: RPY("      << roll << ", " << pitch   << ", " << yaw 
-              << "), Total Rotation: "              << imu_rotation 
-              << " deg, Mode: "                     << imu_stability 
-              << ", Status: "                       << imu_status << "\n\n";
-
-    // Accumulate Totals for summary statistics
-    total_camera_avg_brightness += avg_camera_brightness;
-    total_lidar_avg_distance    += lidar_avg_distance;
-    total_imu_rotation          += imu_rotation;
-    total_obstacles_detected    += obstacles_detected;
   }
 
   // ========================================================================
   // STEP 5: Summary Statistics and Display
   // ========================================================================
-
-  sum_total_readings = total_readings["Camera"] + total_readings["IMU"] + total_readings["LIDAR"];
-  sum_valid_readings = valid_readings["Camera"] + valid_readings["IMU"] + valid_readings["LIDAR"];
-
-  // Print Total Valid and Total Readings Processed, set precision to 2 decimal places for remainder of output
-  std::cout << std::setprecision(2) << "=== SUMMARY STATISTICS ===\n"
-            << "Total Readings Processed: "       << sum_total_readings << '\n'
-            << "Valid Readings: "                 << sum_valid_readings << " ("
-            << (static_cast<double>(sum_valid_readings) / sum_total_readings)*100.0    << "%) \n\n";
-
-  // Print Sensor Reliability Report (valid vs total readings and % Valid)
-  std::cout << "Sensor Reliability Report:" << '\n'
-            << "- LIDAR:   " << valid_readings["LIDAR"]    << "/" << time_steps   << "(" 
-            << (static_cast<double>(valid_readings["LIDAR"])   /     time_steps)*100.0 << "%)\n"
-
-            << "- Camera:  " << valid_readings["Camera"]   << "/" << time_steps   << "("
-            << (static_cast<double>(valid_readings["Camera"])  /     time_steps)*100.0   << "%)\n"
-
-            << "- IMU:     " << valid_readings["IMU"]      << "/" << time_steps   << "("
-            << (static_cast<double>(valid_readings["IMU"])     /     time_steps)*100.0 << "%)\n\n";
-
-  // Print Operational Statistics: Average and count across timestamps)
-  std::cout << "Operational Statistics: \n"
-            << "Average LIDAR Distance:     " << total_lidar_avg_distance    / time_steps << "m \n"
-            << "Total Obstacles Detected:   " << total_obstacles_detected                 << '\n' << std::setprecision(1) 
-            << "Average Camera Brightness:  " << total_camera_avg_brightness / time_steps << '\n'
-            << "   - Day   Mode Detections: " << day_mode_count                           << '\n'
-            << "   - Night Mode Detections: " << night_mode_count                         << '\n'
-            << "Average IMU Total Rotation: " << total_imu_rotation          / time_steps << " deg \n"
-            << "   -   Stable Detections:   " << stable_imu_count                         << '\n'
-            << "   - Unstable Detections:   " << unstable_imu_count                       << '\n';
+  frame_bus.publish(RunComplete{frames_processed});
 
 std::cout   << "\n === END OF PROGRAM === \n";
-}
\ No newline at end of file
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    pose_ekf.cpp
+ * @author  Chris Collins
+ * @brief   Planar pose EKF definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "pose_ekf.hpp"
+#include <cmath>
+
+namespace {
+constexpr double pi{3.14159265358979323846};
+constexpr double deg_to_rad{pi / 180.0};
+
+double wrap_angle(double angle) {
+  angle = std::fmod(angle + pi, 2.0 * pi);
+  return (angle <= 0.0 ? angle + 2.0 * pi : angle) - pi;
+}
+}  // namespace
+
+EkfConfig EkfConfig::defaults() {
+  return {ekf_heading_std * deg_to_rad, ekf_velocity_std, ekf_yaw_rate_std * deg_to_rad, ekf_accel_std,
+          ekf_yaw_accel_std * deg_to_rad};
+}
+
+PoseEkf::PoseEkf(const EkfConfig& config)
+    : config_{config}, p_{Covariance::diagonal(0.01, 0.01, 1.0, 1.0, 1.0)} {}  // Known origin, unknown motion
+
+void PoseEkf::predict(double dt) {
+  const double theta = x_[2];
+  const double v     = x_[3];
+  const double c     = std::cos(theta);
+  const double s     = std::sin(theta);
+
+  x_[0] += v * c * dt;
+  x_[1] += v * s * dt;
+  x_[2] = wrap_angle(theta + x_[4] * dt);
+
+  // Jacobian of the motion model
+  Covariance f = Covariance::identity();
+  f(0, 2)      = -v * s * dt;
+  f(0, 3)      = c * dt;
+  f(1, 2)      = v * c * dt;
+  f(1, 3)      = s * dt;
+  f(2, 4)      = dt;
+
+  // Acceleration noise enters through the velocities (piecewise-constant white acceleration)
+  const double accel_var     = config_.accel_std * config_.accel_std;
+  const double yaw_accel_var = config_.yaw_accel_std * config_.yaw_accel_std;
+  Covariance   q{};
+  q(3, 3) = accel_var * dt * dt;
+  q(4, 4) = yaw_accel_var * dt * dt;
+  q(2, 2) = yaw_accel_var * dt * dt * dt * dt / 4.0;
+  q(2, 4) = q(4, 2) = yaw_accel_var * dt * dt * dt / 2.0;
+  q(0, 0) = q(1, 1) = accel_var * dt * dt * dt * dt / 4.0;
+
+  p_ = f * p_ * transpose(f) + q;
+}
+
+void PoseEkf::update_heading(double yaw) {
+  Mat<1, state_size> h{};
+  h(0, 2) = 1.0;
+  Vec<1> innovation{};
+  innovation[0] = wrap_angle(yaw - x_[2]);
+  Mat<1, 1> r{};
+  r(0, 0) = config_.heading_std * config_.heading_std;
+  correct(innovation, h, r);
+}
+
+void PoseEkf::update_motion(const Pose2D& motion, double dt) {
+  if (dt <= 0.0) { return; }
+  Mat<2, state_size> h{};
+  h(0, 3) = 1.0;
+  h(1, 4) = 1.0;
+  Vec<2> innovation{};
+  innovation[0] = motion.x / dt - x_[3];  // Forward (sensor x) velocity
+  innovation[1] = wrap_angle(motion.theta) / dt - x_[4];
+  const Mat<2, 2> r = Mat<2, 2>::diagonal(config_.velocity_std * config_.velocity_std,
+                                          config_.yaw_rate_std * config_.yaw_rate_std);
+  correct(innovation, h, r);
+}
+
+template <std::size_t M>
+void PoseEkf::correct(const Vec<M>& innovation, const Mat<M, state_size>& h, const Mat<M, M>& r) {
+  const Mat<state_size, M> ht = transpose(h);
+  const Mat<M, M>          s  = h * p_ * ht + r;
+  Mat<M, M>                s_inv{};
+  if (!invert(s, s_inv)) { return; }  // Degenerate innovation covariance: skip the update
+  const Mat<state_size, M> k = p_ * ht * s_inv;
+
+  x_ += k * innovation;
+  x_[2] = wrap_angle(x_[2]);
+
+  // Joseph form keeps P symmetric positive semi-definite
+  const Covariance i_kh = Covariance::identity() - k * h;
+  p_                    = i_kh * p_ * transpose(i_kh) + k * r * transpose(k);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file    producer.cpp
+ * @author  Chris Collins
+ * @brief   Standalone sensor producer: generates simulated sensor frames in its own process and publishes them to
+ *          the rwa2 processor through a shared-memory ring or sends them to its socket ingest server
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: rwa2_producer <shm-name | unix:<path> | tcp:<port>> [frames] [rate_hz] [wait_s]
+ *   target  Shared-memory ring name, or the socket rwa2_cpp --listen is bound to
+ *   frames  Number of frames to publish (default num_timestamps)
+ *   rate_hz Publish rate, 0 publishes as fast as possible (default 10)
+ *   wait_s  Seconds to wait before the first frame so processors can attach (default 1)
+ */
+
+#include "ingest_server.hpp"
+#include "sensor_simulator.hpp"
+#include "shm_transport.hpp"
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <shm-name | unix:<path> | tcp:<port>> [frames] [rate_hz] [wait_s]\n";
+    return 1;
+  }
+  const std::string target{argv[1]};
+  const bool        use_socket = target.rfind("unix:", 0) == 0 || target.rfind("tcp:", 0) == 0;
+  const int         frames  = argc > 2 ? std::stoi(argv[2]) : num_timestamps;
+  const double      rate_hz = argc > 3 ? std::stod(argv[3]) : 10.0;
+  const double      wait_s  = argc > 4 ? std::stod(argv[4]) : 1.0;
+
+  try {
+    SensorSimulator simulator{};
+    TimestampData   data{};  // Reused for every frame
+    const auto period = rate_hz > 0.0 ? std::chrono::duration<double>(1.0 / rate_hz) : std::chrono::duration<double>(0);
+
+    // Generate frames at the requested rate and hand each one to the transport
+    auto run = [&](auto&& send_frame) {
+      std::this_thread::sleep_for(std::chrono::duration<double>(wait_s));
+      auto next_frame = std::chrono::steady_clock::now();
+      for (int i{0}; i < frames; ++i) {
+        simulator.next(i, data);
+        send_frame(data);
+        if (rate_hz > 0.0) {
+          next_frame += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+          std::this_thread::sleep_until(next_frame);
+        }
+      }
+    };
+
+    if (use_socket) {
+      IngestClient client{IngestEndpoint::parse(target)};
+      std::cout << "Sending " << frames << " frames to " << target << '\n';
+      run([&client, rate_hz](const TimestampData& frame) {
+        client.send(frame);
+        if (rate_hz > 0.0) { client.flush(); }  // Paced frames go out immediately, unpaced ones are batched
+      });
+      client.flush();
+    } else {
+      ShmFrameWriter writer{target};
+      std::cout << "Publishing " << frames << " frames to shared memory '" << target << "'\n";
+      run([&writer](const TimestampData& frame) { writer.write(frame); });
+      writer.close();
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+  return 0;
+}
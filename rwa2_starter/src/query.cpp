@@ -0,0 +1,57 @@
+/**
+ * @file    query.cpp
+ * @author  Chris Collins
+ * @brief   Query tool over per-frame results stored by rwa2_cpp --results: loads the column store, rebuilds the
+ *          bitmap indexes and prints the frames matching a query expression
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: rwa2_query <results-file> "<query>" [limit]
+ *   query  e.g. "night lidar_poor obstacles>3 or brightness<20" (see run_query in frame_query.hpp)
+ *   limit  Number of matching frames to list (default 20)
+ */
+
+#include "frame_query.hpp"
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <results-file> \"<query>\" [limit]\n";
+    return 1;
+  }
+  const std::string query{argv[2]};
+  const std::size_t limit = argc > 3 ? std::stoul(argv[3]) : 20;
+
+  try {
+    const FrameResultTable table = FrameResultTable::load(argv[1]);
+
+    const auto          start   = std::chrono::steady_clock::now();
+    const RoaringBitmap matches = run_query(table, query);
+    const auto          elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "Query:   " << query << '\n';
+    std::cout << "Matches: " << matches.cardinality() << " of " << table.size() << " frames ("
+              << std::fixed << std::setprecision(1) << elapsed.count() << " us)\n";
+
+    std::size_t listed{0};
+    matches.for_each([&](std::uint32_t row) {
+      if (listed++ >= limit) { return; }
+      std::cout << "  t=" << table.timestamp(row) << std::setprecision(2)
+                << "  lidar_avg=" << table.value(column_lidar_avg, row)
+                << "  obstacles=" << table.value(column_obstacles, row)
+                << "  brightness=" << table.value(column_brightness, row)
+                << "  rotation=" << table.value(column_rotation, row) << '\n';
+    });
+    if (matches.cardinality() > limit) { std::cout << "  ... (" << matches.cardinality() - limit << " more)\n"; }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+  return 0;
+}
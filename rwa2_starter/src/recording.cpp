@@ -0,0 +1,189 @@
+/**
+ * @file    recording.cpp
+ * @author  Chris Collins
+ * @brief   Block-structured recording writer/reader definitions (footer time index and zone maps)
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "recording.hpp"
+#include "frame_processing.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+constexpr char          file_magic[8]{'R', 'W', 'A', '2', 'R', 'E', 'C', '\0'};
+constexpr char          index_magic[8]{'R', 'W', 'A', '2', 'I', 'D', 'X', '\0'};
+constexpr std::uint32_t recording_version{2};  // 2: frames carry acquisition time
+
+RecordingBlock empty_block(std::uint64_t offset) {
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  return {offset, 0, 0, std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::min(),
+          inf, -inf, inf, -inf, inf, -inf};
+}
+
+bool overlaps(double block_min, double block_max, double query_min, double query_max) {
+  return block_min <= query_max && query_min <= block_max;
+}
+}  // namespace
+
+bool block_may_match(const RecordingBlock& block, const RecordingQuery& query) {
+  return block.t_min <= query.t_end && query.t_begin <= block.t_max &&
+         overlaps(block.lidar_min, block.lidar_max, query.lidar_min, query.lidar_max) &&
+         overlaps(block.brightness_min, block.brightness_max, query.brightness_min, query.brightness_max) &&
+         overlaps(block.rotation_min, block.rotation_max, query.rotation_min, query.rotation_max);
+}
+
+bool frame_matches(const SharedFrame& frame, const RecordingQuery& query) {
+  if (frame.timestamp < query.t_begin || frame.timestamp > query.t_end) { return false; }
+
+  const CameraResult camera = process_camera(frame.timestamp, frame.camera());
+  if (camera.brightness < query.brightness_min || camera.brightness > query.brightness_max) { return false; }
+
+  const ImuResult imu = process_imu(frame.timestamp, frame.imu());
+  if (imu.total_rotation < query.rotation_min || imu.total_rotation > query.rotation_max) { return false; }
+
+  const double* first = frame.lidar;
+  const double* last  = frame.lidar + frame.lidar_count;
+  return std::any_of(first, last, [&query](double r) { return query.lidar_min <= r && r <= query.lidar_max; });
+}
+
+// ========================================================================
+// RecordingWriter
+// ========================================================================
+
+RecordingWriter::RecordingWriter(const std::string& path, std::size_t block_frames)
+    : file_{path, std::ios::binary | std::ios::trunc}, block_frames_{std::max<std::size_t>(block_frames, 1)} {
+  if (!file_) { throw std::runtime_error{"cannot create recording '" + path + "'"}; }
+
+  RecordingFileHeader header{};
+  std::memcpy(header.magic, file_magic, sizeof(header.magic));
+  header.version = recording_version;
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  offset_  = sizeof(header);
+  current_ = empty_block(offset_);
+  block_.reserve(recording_block_bytes + frame_header_bytes + frame_max_payload_bytes);
+}
+
+RecordingWriter::~RecordingWriter() {
+  if (!finished_) { finish(); }
+}
+
+void RecordingWriter::append(const TimestampData& data) {
+  encode_frame(data, block_);
+  add_to_block(data.timestamp, data.lidar_readings.data(), data.lidar_readings.size(), data.camera_readings,
+               data.imu_readings);
+}
+
+void RecordingWriter::append(const SharedFrame& frame) {
+  encode_frame(frame, block_);
+  add_to_block(frame.timestamp, frame.lidar, static_cast<std::size_t>(frame.lidar_count), frame.camera(),
+               frame.imu());
+}
+
+void RecordingWriter::add_to_block(int timestamp, const double* lidar, std::size_t count, const CameraData& camera,
+                                   const ImuData& imu) {
+  // Update zone maps of the open block
+  current_.frames++;
+  current_.t_min = std::min(current_.t_min, timestamp);
+  current_.t_max = std::max(current_.t_max, timestamp);
+  for (std::size_t i{0}; i < count; ++i) {
+    current_.lidar_min = std::min(current_.lidar_min, lidar[i]);
+    current_.lidar_max = std::max(current_.lidar_max, lidar[i]);
+  }
+  const double brightness = process_camera(timestamp, camera).brightness;
+  const double rotation   = process_imu(timestamp, imu).total_rotation;
+  current_.brightness_min = std::min(current_.brightness_min, brightness);
+  current_.brightness_max = std::max(current_.brightness_max, brightness);
+  current_.rotation_min   = std::min(current_.rotation_min, rotation);
+  current_.rotation_max   = std::max(current_.rotation_max, rotation);
+
+  if (current_.frames >= block_frames_ || block_.size() >= recording_block_bytes) { flush_block(); }
+}
+
+void RecordingWriter::flush_block() {
+  if (current_.frames == 0) { return; }
+  current_.bytes = static_cast<std::uint32_t>(block_.size());
+  file_.write(reinterpret_cast<const char*>(block_.data()), static_cast<std::streamsize>(block_.size()));
+  index_.push_back(current_);
+  offset_ += block_.size();
+  block_.clear();
+  current_ = empty_block(offset_);
+}
+
+void RecordingWriter::finish() {
+  if (finished_) { return; }
+  flush_block();
+
+  RecordingTrailer trailer{};
+  trailer.footer_offset = offset_;
+  trailer.block_count   = index_.size();
+  std::memcpy(trailer.magic, index_magic, sizeof(trailer.magic));
+  file_.write(reinterpret_cast<const char*>(index_.data()),
+              static_cast<std::streamsize>(index_.size() * sizeof(RecordingBlock)));
+  file_.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+  file_.flush();
+  finished_ = true;
+}
+
+// ========================================================================
+// RecordingReader
+// ========================================================================
+
+RecordingReader::RecordingReader(const std::string& path) : file_{path, std::ios::binary} {
+  if (!file_) { throw std::runtime_error{"cannot open recording '" + path + "'"}; }
+
+  RecordingFileHeader header{};
+  file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+  file_.seekg(0, std::ios::end);
+  const auto file_bytes = static_cast<std::uint64_t>(file_.tellg());
+  if (!file_ || std::memcmp(header.magic, file_magic, sizeof(file_magic)) != 0 ||
+      header.version != recording_version || file_bytes < sizeof(header) + sizeof(RecordingTrailer)) {
+    throw std::runtime_error{"'" + path + "' is not a sensor recording"};
+  }
+
+  // Trailer at the end of the file locates the footer index: two reads regardless of recording size
+  RecordingTrailer trailer{};
+  file_.seekg(static_cast<std::streamoff>(file_bytes - sizeof(trailer)));
+  file_.read(reinterpret_cast<char*>(&trailer), sizeof(trailer));
+  const std::uint64_t footer_bytes = trailer.block_count * sizeof(RecordingBlock);
+  if (!file_ || std::memcmp(trailer.magic, index_magic, sizeof(index_magic)) != 0 ||
+      trailer.footer_offset + footer_bytes + sizeof(trailer) != file_bytes) {
+    throw std::runtime_error{"recording '" + path + "' has no valid index (was it finished?)"};
+  }
+
+  blocks_.resize(trailer.block_count);
+  file_.seekg(static_cast<std::streamoff>(trailer.footer_offset));
+  file_.read(reinterpret_cast<char*>(blocks_.data()), static_cast<std::streamsize>(footer_bytes));
+  if (!file_) { throw std::runtime_error{"recording '" + path + "' index is truncated"}; }
+
+  for (std::size_t i{1}; i < blocks_.size(); ++i) {
+    if (blocks_[i].t_min < blocks_[i - 1].t_max) { time_sorted_ = false; }
+  }
+}
+
+std::size_t RecordingReader::frame_count() const {
+  std::size_t frames{0};
+  for (const auto& block : blocks_) { frames += block.frames; }
+  return frames;
+}
+
+std::size_t RecordingReader::first_candidate(const RecordingQuery& query) const {
+  if (!time_sorted_) { return 0; }
+  // First block whose range reaches t_begin
+  const auto it = std::partition_point(blocks_.begin(), blocks_.end(),
+                                       [&query](const RecordingBlock& block) { return block.t_max < query.t_begin; });
+  return static_cast<std::size_t>(it - blocks_.begin());
+}
+
+void RecordingReader::load_block(const RecordingBlock& block) {
+  buffer_.resize(block.bytes);
+  file_.clear();
+  file_.seekg(static_cast<std::streamoff>(block.offset));
+  file_.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(block.bytes));
+  if (!file_) { buffer_.resize(static_cast<std::size_t>(file_.gcount())); }
+}
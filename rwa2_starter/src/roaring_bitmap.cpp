@@ -0,0 +1,230 @@
+/**
+ * @file    roaring_bitmap.cpp
+ * @author  Chris Collins
+ * @brief   Roaring-style compressed bitmap definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "roaring_bitmap.hpp"
+#include <algorithm>
+#include <iterator>
+
+std::uint32_t RoaringBitmap::popcount(const std::uint64_t* words, std::size_t count) {
+  std::uint32_t total{0};
+  for (std::size_t w{0}; w < count; ++w) { total += static_cast<std::uint32_t>(__builtin_popcountll(words[w])); }
+  return total;
+}
+
+void RoaringBitmap::add(std::uint32_t value) {
+  const auto key = static_cast<std::uint16_t>(value >> 16);
+  const auto low = static_cast<std::uint16_t>(value & 0xFFFF);
+
+  auto it = containers_.end();
+  if (containers_.empty() || containers_.back().key < key) {  // Ascending append
+    containers_.push_back(Container{key, 0, {}, {}});
+    it = containers_.end() - 1;
+  } else if (containers_.back().key == key) {
+    it = containers_.end() - 1;
+  } else {
+    it = std::lower_bound(containers_.begin(), containers_.end(), key,
+                          [](const Container& c, std::uint16_t k) { return c.key < k; });
+    if (it == containers_.end() || it->key != key) { it = containers_.insert(it, Container{key, 0, {}, {}}); }
+  }
+
+  Container& c = *it;
+  if (!c.bits.empty()) {
+    std::uint64_t& word = c.bits[low >> 6];
+    const std::uint64_t mask = std::uint64_t{1} << (low & 63);
+    if ((word & mask) == 0) {
+      word |= mask;
+      ++c.cardinality;
+    }
+    return;
+  }
+  if (c.array.empty() || c.array.back() < low) {
+    c.array.push_back(low);
+  } else {
+    const auto pos = std::lower_bound(c.array.begin(), c.array.end(), low);
+    if (*pos == low) { return; }
+    c.array.insert(pos, low);
+  }
+  ++c.cardinality;
+  if (c.array.size() > array_max) { to_bitmap(c); }
+}
+
+bool RoaringBitmap::contains(std::uint32_t value) const {
+  const auto key = static_cast<std::uint16_t>(value >> 16);
+  const auto low = static_cast<std::uint16_t>(value & 0xFFFF);
+  const auto it  = std::lower_bound(containers_.begin(), containers_.end(), key,
+                                    [](const Container& c, std::uint16_t k) { return c.key < k; });
+  if (it == containers_.end() || it->key != key) { return false; }
+  if (!it->bits.empty()) { return (it->bits[low >> 6] >> (low & 63)) & 1U; }
+  return std::binary_search(it->array.begin(), it->array.end(), low);
+}
+
+std::uint64_t RoaringBitmap::cardinality() const {
+  std::uint64_t total{0};
+  for (const auto& c : containers_) { total += c.cardinality; }
+  return total;
+}
+
+std::vector<std::uint32_t> RoaringBitmap::to_vector() const {
+  std::vector<std::uint32_t> ids;
+  ids.reserve(cardinality());
+  for_each([&ids](std::uint32_t id) { ids.push_back(id); });
+  return ids;
+}
+
+RoaringBitmap RoaringBitmap::from_words(const std::uint64_t* words, std::size_t word_count) {
+  RoaringBitmap result;
+  for (std::size_t first{0}; first < word_count; first += bitmap_words) {
+    const std::size_t count = std::min(bitmap_words, word_count - first);
+    Container         c{static_cast<std::uint16_t>(first / bitmap_words), 0, {}, {}};
+    c.bits.assign(bitmap_words, 0);
+    std::copy_n(words + first, count, c.bits.begin());
+    c.cardinality = popcount(c.bits.data(), bitmap_words);
+    if (c.cardinality == 0) { continue; }
+    normalize(c);
+    result.containers_.push_back(std::move(c));
+  }
+  return result;
+}
+
+RoaringBitmap RoaringBitmap::range(std::uint32_t count) {
+  std::vector<std::uint64_t> words((static_cast<std::size_t>(count) + 63) / 64, ~std::uint64_t{0});
+  if (count % 64 != 0) { words.back() = (std::uint64_t{1} << (count % 64)) - 1; }
+  return from_words(words.data(), words.size());
+}
+
+void RoaringBitmap::to_bitmap(Container& c) {
+  if (!c.bits.empty()) { return; }
+  c.bits.assign(bitmap_words, 0);
+  for (const std::uint16_t low : c.array) { c.bits[low >> 6] |= std::uint64_t{1} << (low & 63); }
+  c.array.clear();
+  c.array.shrink_to_fit();
+}
+
+void RoaringBitmap::extract(const std::uint64_t* words, Container& c) {
+  c.array.resize(c.cardinality);
+  std::uint16_t* out = c.array.data();
+  for (std::size_t w{0}; w < bitmap_words; ++w) {
+    std::uint64_t word = words[w];
+    while (word != 0) {
+      *out++ = static_cast<std::uint16_t>(w * 64 + static_cast<std::size_t>(__builtin_ctzll(word)));
+      word &= word - 1;
+    }
+  }
+}
+
+void RoaringBitmap::normalize(Container& c) {
+  if (c.bits.empty() || c.cardinality > array_max) { return; }
+  extract(c.bits.data(), c);
+  c.bits.clear();
+  c.bits.shrink_to_fit();
+}
+
+RoaringBitmap::Container RoaringBitmap::combine(const Container& a, const Container& b, Op op) {
+  Container out{a.key, 0, {}, {}};
+
+  if (a.bits.empty() && b.bits.empty()) {  // Both sparse: sorted merge
+    auto sink = std::back_inserter(out.array);
+    switch (op) {
+      case Op::And:    std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), sink); break;
+      case Op::Or:     std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), sink); break;
+      case Op::AndNot: std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), sink); break;
+    }
+    out.cardinality = static_cast<std::uint32_t>(out.array.size());
+    if (out.array.size() > array_max) { to_bitmap(out); }
+    return out;
+  }
+
+  if (op == Op::And && (a.bits.empty() || b.bits.empty())) {  // Sparse & dense: probe the bitmap
+    const Container& sparse = a.bits.empty() ? a : b;
+    const Container& dense  = a.bits.empty() ? b : a;
+    for (const std::uint16_t low : sparse.array) {
+      if ((dense.bits[low >> 6] >> (low & 63)) & 1U) { out.array.push_back(low); }
+    }
+    out.cardinality = static_cast<std::uint32_t>(out.array.size());
+    return out;
+  }
+
+  if (op == Op::AndNot && a.bits.empty()) {  // Sparse minus dense: probe the bitmap
+    for (const std::uint16_t low : a.array) {
+      if (((b.bits[low >> 6] >> (low & 63)) & 1U) == 0) { out.array.push_back(low); }
+    }
+    out.cardinality = static_cast<std::uint32_t>(out.array.size());
+    return out;
+  }
+
+  if (a.bits.empty() || b.bits.empty()) {  // Dense OR sparse, or dense minus sparse: patch a copy of the bitmap
+    const Container& sparse = a.bits.empty() ? a : b;
+    const Container& dense  = a.bits.empty() ? b : a;
+    out.bits                = dense.bits;
+    for (const std::uint16_t low : sparse.array) {
+      const std::uint64_t mask = std::uint64_t{1} << (low & 63);
+      out.bits[low >> 6]       = op == Op::Or ? out.bits[low >> 6] | mask : out.bits[low >> 6] & ~mask;
+    }
+    out.cardinality = popcount(out.bits.data(), bitmap_words);
+    normalize(out);
+    return out;
+  }
+
+  // Both dense: word-wise operation over 1024 words (vectorizes) into a stack buffer, so a sparse result is
+  // extracted straight into its array without allocating a bitmap
+  std::uint64_t        words[bitmap_words];
+  const std::uint64_t* lhs = a.bits.data();
+  const std::uint64_t* rhs = b.bits.data();
+  switch (op) {
+    case Op::And:    for (std::size_t w{0}; w < bitmap_words; ++w) { words[w] = lhs[w] & rhs[w]; } break;
+    case Op::Or:     for (std::size_t w{0}; w < bitmap_words; ++w) { words[w] = lhs[w] | rhs[w]; } break;
+    case Op::AndNot: for (std::size_t w{0}; w < bitmap_words; ++w) { words[w] = lhs[w] & ~rhs[w]; } break;
+  }
+  out.cardinality = popcount(words, bitmap_words);
+  if (out.cardinality > array_max) {
+    out.bits.assign(words, words + bitmap_words);
+  } else {
+    extract(words, out);
+  }
+  return out;
+}
+
+RoaringBitmap RoaringBitmap::merge(const RoaringBitmap& a, const RoaringBitmap& b, Op op) {
+  RoaringBitmap result;
+  result.containers_.reserve(op == Op::And ? std::min(a.containers_.size(), b.containers_.size())
+                                           : a.containers_.size() + b.containers_.size());
+  auto ia = a.containers_.begin();
+  auto ib = b.containers_.begin();
+  while (ia != a.containers_.end() || ib != b.containers_.end()) {
+    const bool take_a = ib == b.containers_.end() || (ia != a.containers_.end() && ia->key < ib->key);
+    const bool take_b = ia == a.containers_.end() || (ib != b.containers_.end() && ib->key < ia->key);
+    if (take_a) {  // Key only in a
+      if (op != Op::And) { result.containers_.push_back(*ia); }
+      ++ia;
+    } else if (take_b) {  // Key only in b
+      if (op == Op::Or) { result.containers_.push_back(*ib); }
+      ++ib;
+    } else {  // Key in both
+      Container c = combine(*ia, *ib, op);
+      if (c.cardinality != 0) { result.containers_.push_back(std::move(c)); }
+      ++ia;
+      ++ib;
+    }
+  }
+  return result;
+}
+
+RoaringBitmap operator&(const RoaringBitmap& a, const RoaringBitmap& b) {
+  return RoaringBitmap::merge(a, b, RoaringBitmap::Op::And);
+}
+
+RoaringBitmap operator|(const RoaringBitmap& a, const RoaringBitmap& b) {
+  return RoaringBitmap::merge(a, b, RoaringBitmap::Op::Or);
+}
+
+RoaringBitmap and_not(const RoaringBitmap& a, const RoaringBitmap& b) {
+  return RoaringBitmap::merge(a, b, RoaringBitmap::Op::AndNot);
+}
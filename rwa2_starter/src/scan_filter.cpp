@@ -0,0 +1,94 @@
+/**
+ * @file    scan_filter.cpp
+ * @author  Chris Collins
+ * @brief   LIDAR scan median/outlier filter definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "scan_filter.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+/**
+ * @brief Compare-exchange: a = min, b = max (no branches, min/max instructions)
+ *
+ */
+inline void sort2(double& a, double& b) {
+  const double low = std::min(a, b);
+  b                = std::max(a, b);
+  a                = low;
+}
+
+/**
+ * @brief Median of 5 with an optimal 9-comparator sorting network (the compiler drops comparators the median does
+ *        not depend on)
+ *
+ */
+inline double median5(double a, double b, double c, double d, double e) {
+  sort2(a, b);
+  sort2(d, e);
+  sort2(c, e);
+  sort2(c, d);
+  sort2(a, d);
+  sort2(a, c);
+  sort2(b, e);
+  sort2(b, d);
+  sort2(b, c);
+  return c;
+}
+}  // namespace
+
+ScanFilter::ScanFilter(const ScanFilterConfig& config) : config_{config} {}
+
+ScanFilterResult ScanFilter::filter(int timestamp, double* ranges, std::size_t count) {
+  ScanFilterResult result{timestamp, 0, 0};
+  if (count == 0) { return result; }
+  if (count != previous_.size()) { history_ = 0; }  // New beam layout: old scans do not line up
+
+  // Circular padding so every beam has two neighbours on each side
+  padded_.resize(count + 4);
+  for (std::size_t k{0}; k < 2; ++k) {
+    padded_[k]             = ranges[(count * 2 + k - 2) % count];
+    padded_[count + 2 + k] = ranges[k % count];
+  }
+  std::copy(ranges, ranges + count, padded_.begin() + 2);
+
+  // Window median of every beam: one straight loop of min/max operations over contiguous arrays (vectorized)
+  median_.resize(count);
+  const double* beam     = padded_.data() + 2;
+  const bool    temporal = history_ == 2;
+  const double* outer_a  = temporal ? previous_.data() : beam - 2;
+  const double* outer_b  = temporal ? older_.data() : beam + 2;
+  double*       median   = median_.data();
+  for (std::size_t i{0}; i < count; ++i) {
+    median[i] = median5(beam[i - 1], beam[i], beam[i + 1], outer_a[i], outer_b[i]);
+  }
+
+  // Replace bad beams with their median when the median itself is usable
+  const double min_valid     = config_.min_valid;
+  const double max_deviation = config_.max_deviation;
+  std::size_t  repaired{0};
+  std::size_t  unrepaired{0};
+  for (std::size_t i{0}; i < count; ++i) {
+    const double reading = ranges[i];
+    const bool   bad     = (reading < min_valid) | (std::abs(reading - median[i]) > max_deviation);
+    const bool   fixable = median[i] >= min_valid;
+    ranges[i]            = bad & fixable ? median[i] : reading;
+    repaired += static_cast<std::size_t>(bad & fixable);
+    unrepaired += static_cast<std::size_t>(bad & !fixable);
+  }
+  result.repaired   = repaired;
+  result.unrepaired = unrepaired;
+
+  // Filtered scan becomes the newest history entry (buffers swap, no allocation once sized)
+  older_.swap(previous_);
+  previous_.assign(ranges, ranges + count);
+  history_ = std::min<std::size_t>(history_ + 1, 2);
+  if (older_.size() != count) { history_ = 1; }
+  return result;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file    scan_matcher.cpp
+ * @author  Chris Collins
+ * @brief   KD-tree and ICP scan matching definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "scan_matcher.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+/**
+ * @brief Solve the 3x3 system A * d = b by Cramer's rule
+ *
+ * @return false if A is (numerically) singular
+ */
+bool solve3(const double a[3][3], const double b[3], double d[3]) {
+  const double det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+                     a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+                     a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+  if (std::abs(det) < 1e-12) { return false; }
+  for (int col{0}; col < 3; ++col) {
+    double m[3][3];
+    for (int r{0}; r < 3; ++r) {
+      for (int c{0}; c < 3; ++c) { m[r][c] = c == col ? b[r] : a[r][c]; }
+    }
+    d[col] = (m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+              m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0])) /
+             det;
+  }
+  return true;
+}
+}  // namespace
+
+Pose2D compose(const Pose2D& outer, const Pose2D& inner) {
+  const double c = std::cos(outer.theta);
+  const double s = std::sin(outer.theta);
+  return {c * inner.x - s * inner.y + outer.x, s * inner.x + c * inner.y + outer.y, outer.theta + inner.theta};
+}
+
+// ========================================================================
+// KdTree2D
+// ========================================================================
+
+void KdTree2D::build(const double* x, const double* y, std::size_t count) {
+  index_.resize(count);
+  std::iota(index_.begin(), index_.end(), 0U);
+  axis_.resize(count);
+  build_range(0, count, x, y);
+
+  x_.resize(count);
+  y_.resize(count);
+  for (std::size_t node{0}; node < count; ++node) {  // Copy coordinates into tree order for cache-friendly search
+    x_[node] = x[index_[node]];
+    y_[node] = y[index_[node]];
+  }
+}
+
+void KdTree2D::build_range(std::size_t begin, std::size_t end, const double* x, const double* y) {
+  if (begin >= end) { return; }
+  // Split on the axis with the larger extent
+  double min_x{x[index_[begin]]}, max_x{min_x}, min_y{y[index_[begin]]}, max_y{min_y};
+  for (std::size_t i{begin + 1}; i < end; ++i) {
+    min_x = std::min(min_x, x[index_[i]]);
+    max_x = std::max(max_x, x[index_[i]]);
+    min_y = std::min(min_y, y[index_[i]]);
+    max_y = std::max(max_y, y[index_[i]]);
+  }
+  const std::uint8_t axis = (max_y - min_y) > (max_x - min_x) ? 1 : 0;
+  const double*      key  = axis == 0 ? x : y;
+
+  const std::size_t mid = begin + (end - begin) / 2;
+  std::nth_element(index_.begin() + static_cast<std::ptrdiff_t>(begin),
+                   index_.begin() + static_cast<std::ptrdiff_t>(mid),
+                   index_.begin() + static_cast<std::ptrdiff_t>(end),
+                   [key](std::uint32_t a, std::uint32_t b) { return key[a] < key[b]; });
+  axis_[mid] = axis;
+  build_range(begin, mid, x, y);
+  build_range(mid + 1, end, x, y);
+}
+
+std::size_t KdTree2D::nearest(double qx, double qy, double max_distance_sq, double& distance_sq) const {
+  struct Range {
+    std::size_t begin, end;
+    double      bound_sq;  // Squared distance from the query to the range's half-plane
+  };
+  Range       stack[64];  // Depth of a balanced tree over < 2^63 points
+  std::size_t top{0};
+  std::size_t best{npos};
+  double      best_sq{max_distance_sq};
+  stack[top++] = {0, index_.size(), 0.0};
+
+  while (top != 0) {
+    const Range range = stack[--top];
+    if (range.begin >= range.end || range.bound_sq >= best_sq) { continue; }  // Pruned by a closer match found since
+    const std::size_t mid = range.begin + (range.end - range.begin) / 2;
+    const double      dx  = qx - x_[mid];
+    const double      dy  = qy - y_[mid];
+    const double      d2  = dx * dx + dy * dy;
+    if (d2 < best_sq) {
+      best_sq = d2;
+      best    = mid;
+    }
+    const double diff  = axis_[mid] == 0 ? dx : dy;
+    const Range  left  = {range.begin, mid, diff < 0.0 ? 0.0 : diff * diff};
+    const Range  right = {mid + 1, range.end, diff < 0.0 ? diff * diff : 0.0};
+    // Near side is pushed last so it is searched first
+    if (diff < 0.0) {
+      stack[top++] = right;
+      stack[top++] = left;
+    } else {
+      stack[top++] = left;
+      stack[top++] = right;
+    }
+  }
+  distance_sq = best_sq;
+  return best == npos ? npos : index_[best];
+}
+
+// ========================================================================
+// ScanMatcher
+// ========================================================================
+
+ScanMatcher::ScanMatcher(const IcpConfig& config) : config_{config} {
+  if (config_.threads > 1) { pool_ = std::make_unique<ThreadPool>(config_.threads); }
+}
+
+void ScanMatcher::set_reference(const PointCloud& scan) {
+  const std::size_t n = scan.size();
+  ref_x_.assign(scan.x.begin(), scan.x.end());
+  ref_y_.assign(scan.y.begin(), scan.y.end());
+  tree_.build(ref_x_.data(), ref_y_.data(), n);
+
+  // Line normal at each point from its neighbours in beam order (one-sided at the ends)
+  ref_nx_.assign(n, 0.0);
+  ref_ny_.assign(n, 0.0);
+  for (std::size_t i{0}; i < n && n > 1; ++i) {
+    const std::size_t prev   = i == 0 ? 0 : i - 1;
+    const std::size_t next   = i + 1 == n ? i : i + 1;
+    const double      tx     = ref_x_[next] - ref_x_[prev];
+    const double      ty     = ref_y_[next] - ref_y_[prev];
+    const double      length = std::hypot(tx, ty);
+    if (length > 0.0) {
+      ref_nx_[i] = -ty / length;
+      ref_ny_[i] = tx / length;
+    }
+  }
+}
+
+IcpResult ScanMatcher::match(const PointCloud& scan, const Pose2D& initial) {
+  if (!has_reference()) { throw std::runtime_error{"scan matcher has no reference scan"}; }
+  const std::size_t n = scan.size();
+  moved_x_.resize(n);
+  moved_y_.resize(n);
+  target_.resize(n);
+  distance_sq_.resize(n);
+
+  IcpResult result{};
+  result.transform = initial;
+  for (std::size_t iteration{0}; iteration < config_.max_iterations; ++iteration) {
+    // Apply the current estimate to every scan point
+    const double c  = std::cos(result.transform.theta);
+    const double s  = std::sin(result.transform.theta);
+    const double tx = result.transform.x;
+    const double ty = result.transform.y;
+    for (std::size_t i{0}; i < n; ++i) {
+      moved_x_[i] = c * scan.x[i] - s * scan.y[i] + tx;
+      moved_y_[i] = s * scan.x[i] + c * scan.y[i] + ty;
+    }
+
+    find_correspondences(n);
+
+    Pose2D     delta{};
+    const bool solved = config_.method == IcpMethod::PointToLine ? solve_point_to_line(n, delta)
+                                                                  : solve_point_to_point(n, delta);
+    if (!solved) { break; }  // Too few pairs (or degenerate geometry) to constrain the transform
+
+    result.transform = compose(delta, result.transform);
+    result.iterations = iteration + 1;
+    if (std::abs(delta.x) < config_.tolerance && std::abs(delta.y) < config_.tolerance &&
+        std::abs(delta.theta) < config_.tolerance) {
+      result.converged = true;
+      break;
+    }
+  }
+
+  double sum_sq{0.0};
+  for (std::size_t i{0}; i < n; ++i) {
+    if (target_[i] == KdTree2D::npos) { continue; }
+    sum_sq += distance_sq_[i];
+    ++result.correspondences;
+  }
+  result.rms_error = result.correspondences == 0 ? 0.0 : std::sqrt(sum_sq / static_cast<double>(result.correspondences));
+  return result;
+}
+
+void ScanMatcher::find_correspondences(std::size_t count) {
+  const double max_sq = config_.max_correspondence_distance * config_.max_correspondence_distance;
+  auto search = [this, max_sq](std::size_t begin, std::size_t end) {
+    for (std::size_t i{begin}; i < end; ++i) {
+      target_[i] = tree_.nearest(moved_x_[i], moved_y_[i], max_sq, distance_sq_[i]);
+    }
+  };
+
+  if (!pool_ || count < icp_parallel_min_points) {
+    search(0, count);
+    return;
+  }
+  // Each task fills a disjoint slice of target_ / distance_sq_ on the matcher's persistent workers
+  const std::size_t tasks = pool_->size();
+  const std::size_t chunk = (count + tasks - 1) / tasks;
+  pool_->run(tasks, [&search, count, chunk](std::size_t t) {
+    search(std::min(count, t * chunk), std::min(count, (t + 1) * chunk));
+  });
+}
+
+bool ScanMatcher::solve_point_to_point(std::size_t count, Pose2D& delta) const {
+  // Closed-form least-squares rigid transform between the paired point sets
+  double      mean_px{0.0}, mean_py{0.0}, mean_qx{0.0}, mean_qy{0.0};
+  std::size_t pairs{0};
+  for (std::size_t i{0}; i < count; ++i) {
+    if (target_[i] == KdTree2D::npos) { continue; }
+    mean_px += moved_x_[i];
+    mean_py += moved_y_[i];
+    mean_qx += ref_x_[target_[i]];
+    mean_qy += ref_y_[target_[i]];
+    ++pairs;
+  }
+  if (pairs < 2) { return false; }
+  const double inv = 1.0 / static_cast<double>(pairs);
+  mean_px *= inv;
+  mean_py *= inv;
+  mean_qx *= inv;
+  mean_qy *= inv;
+
+  double sxx{0.0}, sxy{0.0}, syx{0.0}, syy{0.0};
+  for (std::size_t i{0}; i < count; ++i) {
+    if (target_[i] == KdTree2D::npos) { continue; }
+    const double px = moved_x_[i] - mean_px;
+    const double py = moved_y_[i] - mean_py;
+    const double qx = ref_x_[target_[i]] - mean_qx;
+    const double qy = ref_y_[target_[i]] - mean_qy;
+    sxx += px * qx;
+    sxy += px * qy;
+    syx += py * qx;
+    syy += py * qy;
+  }
+  delta.theta    = std::atan2(sxy - syx, sxx + syy);
+  const double c = std::cos(delta.theta);
+  const double s = std::sin(delta.theta);
+  delta.x        = mean_qx - (c * mean_px - s * mean_py);
+  delta.y        = mean_qy - (s * mean_px + c * mean_py);
+  return true;
+}
+
+bool ScanMatcher::solve_point_to_line(std::size_t count, Pose2D& delta) const {
+  // Gauss-Newton step on sum(((p + t + theta * perp(p)) - q) . n)^2, linearized in theta
+  double      a[3][3]{};
+  double      b[3]{};
+  std::size_t pairs{0};
+  for (std::size_t i{0}; i < count; ++i) {
+    if (target_[i] == KdTree2D::npos) { continue; }
+    const std::size_t j  = target_[i];
+    const double      nx = ref_nx_[j];
+    const double      ny = ref_ny_[j];
+    if (nx == 0.0 && ny == 0.0) { continue; }
+    const double px       = moved_x_[i];
+    const double py       = moved_y_[i];
+    const double jac[3]   = {nx, ny, -py * nx + px * ny};
+    const double residual = (px - ref_x_[j]) * nx + (py - ref_y_[j]) * ny;
+    for (int r{0}; r < 3; ++r) {
+      for (int c{0}; c < 3; ++c) { a[r][c] += jac[r] * jac[c]; }
+      b[r] -= jac[r] * residual;
+    }
+    ++pairs;
+  }
+  double d[3];
+  if (pairs < 3 || !solve3(a, b, d)) { return false; }
+  delta = {d[0], d[1], d[2]};
+  return true;
+}
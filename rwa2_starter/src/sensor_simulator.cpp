@@ -0,0 +1,42 @@
+/**
+ * @file    sensor_simulator.cpp
+ * @author  Chris Collins
+ * @brief   Random sensor data generator definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "sensor_simulator.hpp"
+#include "frame_timing.hpp"
+
+SensorSimulator::SensorSimulator() : gen_{std::random_device{}()} {}
+
+TimestampData SensorSimulator::next(int timestamp) {
+  TimestampData data{};
+  next(timestamp, data);
+  return data;
+}
+
+void SensorSimulator::next(int timestamp, TimestampData& out) {
+  out.lidar_readings.clear();
+  for (int j{0}; j < lidar_readings_count; ++j) {
+    out.lidar_readings.push_back(lidar_distrib_(gen_));  // Generate 8 random LIDAR measurements
+  }
+
+  // Evaluate distributions in separate statements so R, G, B (and Roll, Pitch, Yaw) are drawn in order
+  const int red   = camera_distrib_(gen_);
+  const int green = camera_distrib_(gen_);
+  const int blue  = camera_distrib_(gen_);
+  out.camera_readings = {red, green, blue};
+
+  const double roll  = imu_distrib_(gen_);
+  const double pitch = imu_distrib_(gen_);
+  const double yaw   = imu_distrib_(gen_);
+  out.imu_readings = {roll, pitch, yaw};
+
+  out.timestamp   = timestamp;
+  out.acquired_ns = monotonic_ns();  // Readings are "acquired" once all three sensors have been sampled
+}
@@ -0,0 +1,238 @@
+/**
+ * @file    shm_transport.cpp
+ * @author  Chris Collins
+ * @brief   POSIX shared-memory frame ring definitions (shm_open/mmap, per-slot seqlock, futex wakeups)
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "shm_transport.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using shm_detail::RingHeader;
+using shm_detail::RingSlot;
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex word must be a plain 32-bit int");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "ring sequence numbers must be lock free");
+
+namespace {
+std::string shm_path(const std::string& name) { return (!name.empty() && name[0] == '/') ? name : "/" + name; }
+
+std::uint32_t round_up_pow2(std::uint32_t value) {
+  std::uint32_t capacity{1};
+  while (capacity < value) { capacity <<= 1; }
+  return capacity;
+}
+
+std::runtime_error system_error(const std::string& what, const std::string& name) {
+  return std::runtime_error{what + " '" + name + "': " + std::strerror(errno)};
+}
+
+std::uint32_t* futex_address(std::atomic<std::uint32_t>& word) { return reinterpret_cast<std::uint32_t*>(&word); }
+
+void futex_wake_all(std::atomic<std::uint32_t>& word) {
+  syscall(SYS_futex, futex_address(word), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, int timeout_ms) {
+  timespec timeout{timeout_ms / 1000, static_cast<long>(timeout_ms % 1000) * 1000000L};
+  syscall(SYS_futex, futex_address(word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+std::uint64_t now_ms() {
+  timespec ts{};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<std::uint64_t>(ts.tv_sec) * 1000U + static_cast<std::uint64_t>(ts.tv_nsec) / 1000000U;
+}
+}  // namespace
+
+void fill_shared_frame(const TimestampData& data, SharedFrame& out) {
+  const auto count = std::min<std::size_t>(data.lidar_readings.size(), shm_max_lidar_readings);
+  out.timestamp    = data.timestamp;
+  out.lidar_count  = static_cast<int>(count);
+  out.acquired_ns  = data.acquired_ns;
+  std::copy_n(data.lidar_readings.begin(), count, out.lidar);
+  std::tie(out.rgb[0], out.rgb[1], out.rgb[2]) = data.camera_readings;
+  std::tie(out.rpy[0], out.rpy[1], out.rpy[2]) = data.imu_readings;
+}
+
+std::size_t shm_detail::mapping_bytes(std::uint32_t capacity) {
+  const std::size_t header_bytes = (sizeof(RingHeader) + alignof(RingSlot) - 1) / alignof(RingSlot) * alignof(RingSlot);
+  return header_bytes + sizeof(RingSlot) * capacity;
+}
+
+namespace {
+RingSlot* slots_after(RingHeader* header) {
+  const std::size_t header_bytes = shm_detail::mapping_bytes(0);
+  return reinterpret_cast<RingSlot*>(reinterpret_cast<char*>(header) + header_bytes);
+}
+}  // namespace
+
+// ========================================================================
+// ShmFrameWriter
+// ========================================================================
+
+ShmFrameWriter::ShmFrameWriter(const std::string& name, std::uint32_t capacity) : name_{shm_path(name)} {
+  capacity = round_up_pow2(std::max<std::uint32_t>(capacity, 2));
+  bytes_   = shm_detail::mapping_bytes(capacity);
+
+  shm_unlink(name_.c_str());  // Replace any ring left behind by a crashed writer
+  const int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) { throw system_error("shm_open failed for", name_); }
+  if (ftruncate(fd, static_cast<off_t>(bytes_)) != 0) {
+    ::close(fd);
+    shm_unlink(name_.c_str());
+    throw system_error("ftruncate failed for", name_);
+  }
+  void* memory = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);  // The mapping keeps the object alive
+  if (memory == MAP_FAILED) {
+    shm_unlink(name_.c_str());
+    throw system_error("mmap failed for", name_);
+  }
+
+  header_ = new (memory) RingHeader{};
+  slots_  = slots_after(header_);
+  for (std::uint32_t i{0}; i < capacity; ++i) {
+    new (&slots_[i]) RingSlot{};
+    slots_[i].seq.store(0, std::memory_order_relaxed);
+  }
+  header_->version     = shm_detail::ring_version;
+  header_->capacity    = capacity;
+  header_->frame_bytes = sizeof(SharedFrame);
+  header_->published.store(0, std::memory_order_relaxed);
+  header_->futex_word.store(0, std::memory_order_relaxed);
+  header_->waiters.store(0, std::memory_order_relaxed);
+  header_->closed.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  header_->magic = shm_detail::ring_magic;  // Written last: readers reject the ring until it is initialized
+}
+
+ShmFrameWriter::~ShmFrameWriter() {
+  if (header_ == nullptr) { return; }
+  close();
+  munmap(header_, bytes_);
+  shm_unlink(name_.c_str());  // Attached readers keep their mapping until they detach
+}
+
+SharedFrame& ShmFrameWriter::claim() {
+  RingSlot& slot = slots_[(next_ - 1) & (header_->capacity - 1)];
+  slot.seq.store(2 * next_ - 1, std::memory_order_relaxed);  // Odd: slot is being rewritten
+  std::atomic_thread_fence(std::memory_order_release);
+  return slot.frame;
+}
+
+void ShmFrameWriter::publish() {
+  RingSlot& slot = slots_[(next_ - 1) & (header_->capacity - 1)];
+  slot.seq.store(2 * next_, std::memory_order_release);  // Even: frame next_ is readable
+  header_->published.store(next_, std::memory_order_release);
+  ++next_;
+
+  header_->futex_word.fetch_add(1, std::memory_order_seq_cst);
+  if (header_->waiters.load(std::memory_order_seq_cst) != 0) { futex_wake_all(header_->futex_word); }
+}
+
+void ShmFrameWriter::write(const TimestampData& data) {
+  fill_shared_frame(data, claim());
+  publish();
+}
+
+void ShmFrameWriter::close() {
+  if (header_->closed.exchange(1, std::memory_order_seq_cst) != 0) { return; }
+  header_->futex_word.fetch_add(1, std::memory_order_seq_cst);
+  futex_wake_all(header_->futex_word);
+}
+
+// ========================================================================
+// ShmFrameReader
+// ========================================================================
+
+ShmFrameReader::ShmFrameReader(const std::string& name) {
+  const std::string path = shm_path(name);
+  const int         fd   = shm_open(path.c_str(), O_RDWR, 0);
+  if (fd < 0) { throw system_error("shm_open failed for", path); }
+
+  struct stat info {};
+  if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(RingHeader)) {
+    ::close(fd);
+    throw std::runtime_error{"shared-memory ring '" + path + "' is not initialized"};
+  }
+  bytes_       = static_cast<std::size_t>(info.st_size);
+  void* memory = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);  // Write access for waiters count
+  ::close(fd);
+  if (memory == MAP_FAILED) { throw system_error("mmap failed for", path); }
+
+  header_ = static_cast<RingHeader*>(memory);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (header_->magic != shm_detail::ring_magic || header_->version != shm_detail::ring_version ||
+      header_->frame_bytes != sizeof(SharedFrame) || shm_detail::mapping_bytes(header_->capacity) > bytes_) {
+    munmap(header_, bytes_);
+    header_ = nullptr;
+    throw std::runtime_error{"shared-memory ring '" + path + "' has an incompatible layout"};
+  }
+  slots_ = slots_after(header_);
+  mask_  = header_->capacity - 1;
+  skip_to_oldest();
+}
+
+ShmFrameReader::~ShmFrameReader() {
+  if (header_ != nullptr) { munmap(header_, bytes_); }
+}
+
+void ShmFrameReader::skip_to_oldest() {
+  // The slot after the newest frame may already be mid-rewrite, so the oldest safe frame is capacity - 2 back
+  const std::uint64_t published = header_->published.load(std::memory_order_acquire);
+  const std::uint64_t capacity  = header_->capacity;
+  if (published + 2 > capacity) { next_ = std::max(next_, published + 2 - capacity); }
+}
+
+ShmReadStatus ShmFrameReader::wait_for_next(int timeout_ms) {
+  const std::uint64_t deadline = now_ms() + static_cast<std::uint64_t>(std::max(timeout_ms, 0));
+  int                 spins{0};
+
+  while (header_->published.load(std::memory_order_acquire) < next_) {
+    if (header_->closed.load(std::memory_order_acquire) != 0 &&
+        header_->published.load(std::memory_order_acquire) < next_) {
+      return ShmReadStatus::Closed;
+    }
+    if (spins < shm_default_spin) {  // Short spin keeps hand-off latency low while frames are flowing
+      ++spins;
+      continue;
+    }
+
+    const std::uint64_t now = now_ms();
+    if (now >= deadline) { return ShmReadStatus::Timeout; }
+
+    header_->waiters.fetch_add(1, std::memory_order_seq_cst);
+    const std::uint32_t word = header_->futex_word.load(std::memory_order_seq_cst);
+    if (header_->published.load(std::memory_order_seq_cst) < next_ &&
+        header_->closed.load(std::memory_order_seq_cst) == 0) {
+      futex_wait(header_->futex_word, word, static_cast<int>(deadline - now));
+    }
+    header_->waiters.fetch_sub(1, std::memory_order_seq_cst);
+  }
+
+  const std::uint64_t published = header_->published.load(std::memory_order_acquire);
+  if (published - next_ + 2 > header_->capacity ||
+      slot_for(next_).seq.load(std::memory_order_acquire) != 2 * next_) {  // Lapped by the writer
+    ++overruns_;
+    skip_to_oldest();
+    return ShmReadStatus::Overrun;
+  }
+  return ShmReadStatus::Frame;
+}
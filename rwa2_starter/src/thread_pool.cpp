@@ -0,0 +1,81 @@
+/**
+ * @file    thread_pool.cpp
+ * @author  Chris Collins
+ * @brief   Thread pool definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "thread_pool.hpp"
+
+ThreadPool::ThreadPool(std::size_t threads) {
+  const std::size_t workers = threads > 1 ? threads - 1 : 0;
+  workers_.reserve(workers);
+  for (std::size_t i{0}; i < workers; ++i) { workers_.emplace_back(&ThreadPool::worker_loop, this); }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) { worker.join(); }
+}
+
+void ThreadPool::run_tasks(std::size_t tasks, TaskFn fn, void* context) {
+  if (tasks == 0) { return; }
+  if (workers_.empty() || tasks == 1) {  // Nothing to share: run on the caller
+    for (std::size_t task{0}; task < tasks; ++task) { fn(context, task); }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    fn_           = fn;
+    context_      = context;
+    tasks_        = tasks;
+    busy_workers_ = workers_.size();
+    error_        = nullptr;
+    next_.store(0, std::memory_order_relaxed);
+    ++generation_;
+  }
+  wake_.notify_all();
+  work();
+
+  std::unique_lock<std::mutex> lock{mutex_};
+  done_.wait(lock, [this] { return busy_workers_ == 0; });
+  if (error_) { std::rethrow_exception(error_); }
+}
+
+void ThreadPool::worker_loop() {
+  std::uint64_t seen{0};
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      wake_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+      if (stop_) { return; }
+      seen = generation_;
+    }
+    work();
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (--busy_workers_ == 0) { done_.notify_one(); }
+  }
+}
+
+void ThreadPool::work() {
+  // fn_, context_ and tasks_ were published under the mutex before this run's wake-up
+  for (;;) {
+    const std::size_t task = next_.fetch_add(1, std::memory_order_relaxed);
+    if (task >= tasks_) { return; }
+    try {
+      fn_(context_, task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (!error_) { error_ = std::current_exception(); }
+    }
+  }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file    voxel_grid.cpp
+ * @author  Chris Collins
+ * @brief   Voxel-grid downsampling definitions
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "voxel_grid.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+constexpr std::size_t voxel_initial_slots{1024};
+
+/**
+ * @brief Pack the (ix, iy) cell index of a point into one key
+ *
+ */
+inline std::uint64_t cell_key(double x, double y, double inv_cell_size) {
+  const auto ix = static_cast<std::int32_t>(std::floor(x * inv_cell_size));
+  const auto iy = static_cast<std::int32_t>(std::floor(y * inv_cell_size));
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ix)) << 32) | static_cast<std::uint32_t>(iy);
+}
+
+/**
+ * @brief 64-bit mix of a cell key. Low bits select the table slot, high bits select the partition.
+ *
+ */
+inline std::uint64_t cell_hash(std::uint64_t key) {
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return key;
+}
+
+inline std::size_t partition_of(std::uint64_t hash, std::size_t partitions) {
+  return static_cast<std::size_t>(hash >> 32) % partitions;
+}
+}  // namespace
+
+namespace voxel_detail {
+
+void VoxelTable::insert(std::uint64_t key, std::uint64_t hash, double x, double y) {
+  if ((used_.size() + 1) * 2 > slots_.size()) { grow(); }  // Keep load factor <= 0.5
+  const std::size_t mask = slots_.size() - 1;
+  for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+    VoxelCell& cell = slots_[slot];
+    if (cell.count == 0) {
+      cell = VoxelCell{key, x, y, 1};
+      used_.push_back(static_cast<std::uint32_t>(slot));
+      return;
+    }
+    if (cell.key == key) {
+      cell.sum_x += x;
+      cell.sum_y += y;
+      ++cell.count;
+      return;
+    }
+  }
+}
+
+void VoxelTable::clear() {
+  for (const std::uint32_t slot : used_) { slots_[slot].count = 0; }  // Only touch occupied slots
+  used_.clear();
+}
+
+void VoxelTable::grow() {
+  std::vector<VoxelCell>     old_slots = std::move(slots_);
+  std::vector<std::uint32_t> old_used  = std::move(used_);
+  slots_.assign(old_slots.empty() ? voxel_initial_slots : old_slots.size() * 2, VoxelCell{0, 0.0, 0.0, 0});
+  used_.clear();
+  used_.reserve(old_used.capacity());
+
+  const std::size_t mask = slots_.size() - 1;
+  for (const std::uint32_t old_slot : old_used) {  // Reinsert in the original insertion order
+    const VoxelCell& cell = old_slots[old_slot];
+    std::size_t      slot = cell_hash(cell.key) & mask;
+    while (slots_[slot].count != 0) { slot = (slot + 1) & mask; }
+    slots_[slot] = cell;
+    used_.push_back(static_cast<std::uint32_t>(slot));
+  }
+}
+
+}  // namespace voxel_detail
+
+VoxelGrid::VoxelGrid(double cell_size, std::size_t partitions)
+    : cell_size_{cell_size}, inv_cell_size_{1.0 / cell_size}, tables_(partitions) {
+  if (!(cell_size > 0.0)) { throw std::invalid_argument{"voxel cell size must be positive"}; }
+  if (partitions == 0) { throw std::invalid_argument{"voxel grid needs at least one partition"}; }
+  if (partitions > 1) { pool_ = std::make_unique<ThreadPool>(partitions); }
+}
+
+void VoxelGrid::add(const double* x, const double* y, std::size_t count) {
+  // Cell keys for the whole batch first (a straight loop over contiguous arrays), then insertion
+  keys_.resize(count);
+  for (std::size_t i{0}; i < count; ++i) { keys_[i] = cell_key(x[i], y[i], inv_cell_size_); }
+  points_ += count;
+
+  const std::size_t partitions = tables_.size();
+  if (partitions == 1 || count < voxel_parallel_min_points) {
+    for (std::size_t i{0}; i < count; ++i) {
+      const std::uint64_t hash = cell_hash(keys_[i]);
+      tables_[partition_of(hash, partitions)].insert(keys_[i], hash, x[i], y[i]);
+    }
+    return;
+  }
+
+  // Bucket the batch by partition with a counting pass over the hashes, keeping batch order within each bucket
+  hashes_.resize(count);
+  offsets_.assign(partitions + 1, 0);
+  for (std::size_t i{0}; i < count; ++i) {
+    hashes_[i] = cell_hash(keys_[i]);
+    ++offsets_[partition_of(hashes_[i], partitions) + 1];
+  }
+  for (std::size_t p{0}; p < partitions; ++p) { offsets_[p + 1] += offsets_[p]; }
+  order_.resize(count);
+  for (std::size_t i{0}; i < count; ++i) {  // Each start advances to the next partition's start
+    order_[offsets_[partition_of(hashes_[i], partitions)]++] = static_cast<std::uint32_t>(i);
+  }
+  for (std::size_t p{partitions}; p > 0; --p) { offsets_[p] = offsets_[p - 1]; }
+  offsets_[0] = 0;
+
+  // One persistent worker per partition, each inserting only the points whose cell it owns
+  pool_->run(partitions, [this, x, y](std::size_t p) {
+    for (std::size_t j{offsets_[p]}; j < offsets_[p + 1]; ++j) {
+      const std::uint32_t i = order_[j];
+      tables_[p].insert(keys_[i], hashes_[i], x[i], y[i]);
+    }
+  });
+}
+
+void VoxelGrid::downsample(PointCloud& out) const {
+  const std::size_t cells = cell_count();
+  out.x.resize(cells);
+  out.y.resize(cells);
+  std::size_t i{0};
+  for (const auto& table : tables_) {
+    table.for_each([&out, &i](const voxel_detail::VoxelCell& cell) {
+      const double inv_count = 1.0 / static_cast<double>(cell.count);
+      out.x[i]               = cell.sum_x * inv_count;
+      out.y[i]               = cell.sum_y * inv_count;
+      ++i;
+    });
+  }
+}
+
+void VoxelGrid::clear() {
+  for (auto& table : tables_) { table.clear(); }
+  points_ = 0;
+}
+
+std::size_t VoxelGrid::cell_count() const {
+  std::size_t cells{0};
+  for (const auto& table : tables_) { cells += table.size(); }
+  return cells;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file    anomaly_detector_test.cpp
+ * @author  Chris Collins
+ * @brief   A spike injected into an otherwise steady stream must be flagged, by both scoring methods, once the
+ *          detector has enough history, and ordinary samples must not be
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "anomaly_detector.hpp"
+#include "sensor_types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+int failures{0};
+
+void check(bool ok, const std::string& what) {
+  if (!ok) {
+    std::cerr << "FAILED: " << what << '\n';
+    ++failures;
+  }
+}
+
+// Feed samples spread around 100 on every stream, then one frame whose stream spike_stream jumps by spike
+void spike_test(AnomalyMethod method, const std::string& name) {
+  constexpr std::size_t streams{anomaly_channel_count};
+  constexpr std::size_t spike_stream{anomaly_brightness_channel};
+  const AnomalyConfig   config{anomaly_window, anomaly_min_history, anomaly_threshold, method};
+  AnomalyDetector       detector{streams, config};
+
+  const double              wobble[]{-1.0, 1.0, -0.5, 0.5};  // Deterministic spread around 100
+  std::vector<AnomalyEvent> flagged;
+  int                       timestamp{0};
+  auto frame = [&](double spike) {
+    double values[streams]{};
+    for (std::size_t s{0}; s < streams; ++s) { values[s] = 100.0 + wobble[(static_cast<std::size_t>(timestamp) + s) % 4]; }
+    values[spike_stream] += spike;
+    return detector.update(timestamp++, values, flagged);
+  };
+
+  // Before min_history samples nothing is scored, however far a sample is off
+  for (std::size_t i{0}; i < anomaly_min_history; ++i) { frame(i == 1 ? 1000.0 : 0.0); }
+  check(flagged.empty(), name + ": sample flagged before the detector had min_history samples");
+
+  // Fill the window with ordinary samples (the early outlier ages out), then inject the spike
+  flagged.clear();
+  for (std::size_t i{0}; i < anomaly_window; ++i) { frame(0.0); }
+  check(flagged.empty(), name + ": ordinary sample flagged");
+  const int spike_timestamp{timestamp};
+  check(frame(50.0) == 1, name + ": spike not flagged, or flagged on more than one stream");
+  check(flagged.size() == 1 && flagged[0].timestamp == spike_timestamp && flagged[0].stream == spike_stream,
+        name + ": wrong timestamp or stream flagged");
+}
+}  // namespace
+
+int main() {
+  spike_test(AnomalyMethod::ZScore, "z-score");
+  spike_test(AnomalyMethod::MedianMad, "median/MAD");
+
+  // Short history: a few std is not enough to flag, a spike far outside the small-sample interval is
+  const AnomalyConfig config{anomaly_window, 4, anomaly_threshold, AnomalyMethod::ZScore};
+  const double        history[]{9.0, 11.0, 9.0, 11.0};  // Mean 10, sample std 1.15
+  const double        moderate{10.0 + 4.0 * 1.15};
+  const double        spike{10.0 + 30.0 * 1.15};
+  for (const double sample : {moderate, spike}) {
+    AnomalyDetector           detector{1, config};
+    std::vector<AnomalyEvent> flagged;
+    for (int i{0}; i < 4; ++i) { detector.update(i, &history[i], flagged); }
+    check(detector.update(4, &sample, flagged) == (sample == spike ? 1U : 0U),
+          "z-score after 4 samples: " + std::string{sample == spike ? "30-sigma spike not flagged"
+                                                                    : "4-sigma sample flagged"});
+  }
+
+  if (failures == 0) { std::cout << "anomaly_detector_test: all checks passed\n"; }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    async_logger_test.cpp
+ * @author  Chris Collins
+ * @brief   Text arguments whose length is a multiple of 8 bytes must not write past their record, including records
+ *          that end exactly at the end of the log ring
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "async_logger.hpp"
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+constexpr std::size_t   ring_words{64};
+constexpr std::uint64_t sentinel{0xDEADBEEFCAFEF00DULL};
+
+int failures{0};
+
+void check(bool ok, const std::string& what) {
+  if (!ok) {
+    std::cerr << "FAILED: " << what << '\n';
+    ++failures;
+  }
+}
+
+// Write one text record of length bytes into ring and check it decodes and ends where it should
+void write_record(log_detail::LogRing& ring, const std::string& text, const std::string& where) {
+  const std::size_t words = 1 + log_detail::arg_words(text);
+  std::uint64_t*    start = ring.reserve(words);
+  std::uint64_t*    out   = start;
+  *out++                  = log_detail::record_header(0, words);
+  log_detail::write_arg(out, text);
+  ring.commit(words);
+  check(out == start + words, where + ": record of " + std::to_string(text.size()) + " bytes has the wrong size");
+  check(std::memcmp(start + 2, text.data(), text.size()) == 0, where + ": text not copied");
+}
+}  // namespace
+
+int main() {
+  for (const std::size_t length : {0, 8, 16}) {
+    const std::string text(length, 'x');
+    const std::size_t words = 1 + log_detail::arg_words(text);
+
+    // Record ending exactly at the end of the ring: a write past it overruns the ring's heap block (ASan)
+    log_detail::LogRing end_ring{ring_words};
+    end_ring.reserve(ring_words - words);
+    end_ring.commit(ring_words - words);
+    write_record(end_ring, text, "ring end");
+
+    // Record in mid-ring: the word after it is free space and must be left alone
+    log_detail::LogRing mid_ring{ring_words};
+    std::uint64_t*      start = mid_ring.reserve(words + 1);
+    start[words]              = sentinel;
+    write_record(mid_ring, text, "mid-ring");
+    check(*mid_ring.at(words) == sentinel, "mid-ring: word after a " + std::to_string(length) +
+                                               "-byte text record was overwritten");
+  }
+
+  if (failures == 0) { std::cout << "async_logger_test: all checks passed\n"; }
+  return failures == 0 ? 0 : 1;
+}
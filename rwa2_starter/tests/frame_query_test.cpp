@@ -0,0 +1,107 @@
+/**
+ * @file    frame_query_test.cpp
+ * @author  Chris Collins
+ * @brief   Queries over a result table large enough to hold both sparse (array) and dense (bitmap) containers must
+ *          match a row-by-row evaluation, and bad comparison values must be reported with their term
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_query.hpp"
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::uint32_t rows{300000};  // Several 65536-row containers
+
+int failures{0};
+
+void check(bool ok, const std::string& what) {
+  if (!ok) {
+    std::cerr << "FAILED: " << what << '\n';
+    ++failures;
+  }
+}
+
+// Deterministic pseudo-random value in [0, 1) per row and salt
+double hash01(std::uint32_t row, std::uint32_t salt) {
+  std::uint64_t x = (static_cast<std::uint64_t>(row) << 32 | salt) * 0x9E3779B97F4A7C15ULL;
+  x ^= x >> 29;
+  x *= 0xBF58476D1CE4E5B9ULL;
+  x ^= x >> 32;
+  return static_cast<double>(x >> 11) / static_cast<double>(std::uint64_t{1} << 53);
+}
+
+ProcessedFrame make_frame(std::uint32_t row) {
+  ProcessedFrame frame{};
+  frame.timestamp          = static_cast<int>(row);
+  frame.lidar.avg_distance = 10.0 * hash01(row, 1);
+  frame.lidar.obstacles    = static_cast<int>(9.0 * hash01(row, 2));
+  frame.lidar.valid        = hash01(row, 3) > (row < 2 * 65536 ? 0.3 : 0.97);  // Dense, then sparse poor rows
+  frame.camera.brightness  = 255.0 * hash01(row, 4);
+  frame.camera.night       = frame.camera.brightness <= 50.0;
+  frame.camera.valid       = frame.camera.brightness >= 20.0;
+  frame.imu.total_rotation = 150.0 * hash01(row, 5);
+  frame.imu.stable         = frame.imu.total_rotation < (row >= 65536 ? 90.0 : 8.0);  // Sparse, then dense
+  frame.imu.valid          = true;
+  return frame;
+}
+
+struct Case {
+  const char*                                query;
+  std::function<bool(const ProcessedFrame&)> expected;
+};
+}  // namespace
+
+int main() {
+  FrameResultTable table;
+  for (std::uint32_t row{0}; row < rows; ++row) { table.append(make_frame(row)); }
+
+  const Case cases[]{
+      {"night", [](const ProcessedFrame& f) { return f.camera.night; }},
+      {"!night", [](const ProcessedFrame& f) { return !f.camera.night; }},
+      {"night lidar_poor", [](const ProcessedFrame& f) { return f.camera.night && !f.lidar.valid; }},
+      {"night lidar_poor obstacles>3",
+       [](const ProcessedFrame& f) { return f.camera.night && !f.lidar.valid && f.lidar.obstacles > 3; }},
+      {"obstacles>3 night !stable",
+       [](const ProcessedFrame& f) { return f.lidar.obstacles > 3 && f.camera.night && !f.imu.stable; }},
+      {"lidar_poor !stable", [](const ProcessedFrame& f) { return !f.lidar.valid && !f.imu.stable; }},
+      {"stable !lidar_poor", [](const ProcessedFrame& f) { return f.imu.stable && f.lidar.valid; }},
+      {"!obstacles>=2 day", [](const ProcessedFrame& f) { return !(f.lidar.obstacles >= 2) && !f.camera.night; }},
+      {"stable or lidar_poor", [](const ProcessedFrame& f) { return f.imu.stable || !f.lidar.valid; }},
+      {"t<70000 lidar_avg<1 or t>=250000 brightness>200 or camera_poor",
+       [](const ProcessedFrame& f) {
+         return (f.timestamp < 70000 && static_cast<float>(f.lidar.avg_distance) < 1.0F) ||
+                (f.timestamp >= 250000 && static_cast<float>(f.camera.brightness) > 200.0F) || !f.camera.valid;
+       }},
+  };
+  for (const Case& c : cases) {
+    const std::vector<std::uint32_t> got = run_query(table, c.query).to_vector();
+    std::vector<std::uint32_t>       want;
+    for (std::uint32_t row{0}; row < rows; ++row) {
+      if (c.expected(make_frame(row))) { want.push_back(row); }
+    }
+    check(got == want, std::string{"'"} + c.query + "': " + std::to_string(got.size()) + " rows, expected " +
+                           std::to_string(want.size()));
+  }
+
+  for (const char* bad : {"obstacles>abc", "obstacles>3x"}) {
+    try {
+      run_query(table, bad);
+      check(false, std::string{"'"} + bad + "' accepted");
+    } catch (const std::invalid_argument& e) {
+      check(std::string{e.what()}.find(bad) != std::string::npos,
+            std::string{"'"} + bad + "' reported as '" + e.what() + "'");
+    }
+  }
+
+  if (failures == 0) { std::cout << "frame_query_test: all checks passed\n"; }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file    ingest_server_test.cpp
+ * @author  Chris Collins
+ * @brief   IngestServer against local stand-in producers: several producers sending at once, frames split across
+ *          reads, and corrupt or oversized length prefixes dropped and counted as protocol errors
+ * @version 1.0
+ * @date    10-18-2026
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "frame_codec.hpp"
+#include "ingest_server.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+constexpr int producers{4};
+constexpr int frames_per_producer{500};
+constexpr int max_polls{1000};  // Upper bound on polls while waiting for the server to catch up
+
+int failures{0};
+
+void check(bool ok, const std::string& what) {
+  if (!ok) {
+    std::cerr << "FAILED: " << what << '\n';
+    ++failures;
+  }
+}
+
+// Frame i of a producer: its timestamp identifies the producer and the readings are derived from the timestamp
+TimestampData make_frame(int timestamp) {
+  TimestampData data{};
+  data.timestamp       = timestamp;
+  data.lidar_readings  = {0.5 * timestamp, 1.0, 2.0, static_cast<double>(timestamp % 7)};
+  data.camera_readings = {timestamp % 256, 1, 2};
+  data.imu_readings    = {1.0, 2.0, 0.25 * timestamp};
+  return data;
+}
+
+bool matches(const SharedFrame& frame) {
+  const TimestampData expected = make_frame(frame.timestamp);
+  return frame.lidar_count == static_cast<int>(expected.lidar_readings.size()) &&
+         std::memcmp(frame.lidar, expected.lidar_readings.data(), expected.lidar_readings.size() * sizeof(double)) ==
+             0 &&
+         frame.camera() == expected.camera_readings && frame.imu() == expected.imu_readings;
+}
+
+// Stand-in producer writing raw bytes, so a test controls exactly how the stream is cut
+class RawProducer {
+ public:
+  explicit RawProducer(const std::string& path) : fd_{socket(AF_UNIX, SOCK_STREAM, 0)} {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    connected_ = connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+  }
+  ~RawProducer() { close(); }
+
+  RawProducer(const RawProducer&)            = delete;
+  RawProducer& operator=(const RawProducer&) = delete;
+
+  bool connected() const { return connected_; }
+
+  void write(const unsigned char* bytes, std::size_t count) {
+    while (count != 0) {
+      const ssize_t written = ::write(fd_, bytes, count);
+      if (written <= 0) { return; }
+      bytes += written;
+      count -= static_cast<std::size_t>(written);
+    }
+  }
+
+  void close() {
+    if (fd_ >= 0) { ::close(fd_); }
+    fd_ = -1;
+  }
+
+ private:
+  int  fd_;
+  bool connected_{false};
+};
+
+// Poll until done() holds or max_polls polls went by; returns the number of frames delivered
+template <typename Fn, typename Done>
+std::size_t poll_until(IngestServer& server, Fn&& on_frame, Done&& done) {
+  std::size_t frames{0};
+  for (int i{0}; i < max_polls && !done(); ++i) { frames += server.poll(on_frame, 10); }
+  return frames;
+}
+
+void concurrent_producers(const std::string& path) {
+  IngestServer server{IngestEndpoint::parse("unix:" + path)};
+
+  std::vector<std::thread> threads;
+  for (int p{0}; p < producers; ++p) {
+    threads.emplace_back([&path, p] {
+      IngestClient client{IngestEndpoint::parse("unix:" + path)};
+      for (int i{0}; i < frames_per_producer; ++i) { client.send(make_frame(p * frames_per_producer + i)); }
+      client.flush();
+    });
+  }
+
+  std::vector<int> next(producers, 0);  // Next expected frame index per producer
+  std::size_t      corrupt{0};
+  bool             in_order{true};
+  const auto       on_frame = [&](const SharedFrame& frame) {
+    const int p = frame.timestamp / frames_per_producer;
+    if (p < 0 || p >= producers || !matches(frame)) {
+      ++corrupt;
+      return;
+    }
+    in_order = in_order && frame.timestamp % frames_per_producer == next[static_cast<std::size_t>(p)];
+    ++next[static_cast<std::size_t>(p)];
+  };
+  const std::size_t frames = poll_until(server, on_frame, [&server] {
+    return server.total_connections() == producers && server.active_connections() == 0;
+  });
+  for (std::thread& thread : threads) { thread.join(); }
+
+  check(frames == static_cast<std::size_t>(producers * frames_per_producer),
+        "concurrent producers: " + std::to_string(frames) + " frames delivered");
+  check(corrupt == 0, "concurrent producers: " + std::to_string(corrupt) + " frames with wrong contents");
+  check(in_order, "concurrent producers: frames of one producer delivered out of order");
+  check(server.protocol_errors() == 0, "concurrent producers: protocol errors on well-formed streams");
+}
+
+void split_frames(const std::string& path) {
+  IngestServer server{IngestEndpoint::parse("unix:" + path)};
+  RawProducer  producer{path};
+  check(producer.connected(), "split frames: producer could not connect");
+
+  std::vector<unsigned char> bytes;
+  encode_frame(make_frame(42), bytes);
+  encode_frame(make_frame(43), bytes);
+  const std::size_t first_frame = encoded_frame_bytes(make_frame(42).lidar_readings.size());
+
+  std::size_t delivered{0};
+  const auto  on_frame = [&delivered](const SharedFrame& frame) {
+    check(frame.timestamp == 42 + static_cast<int>(delivered) && matches(frame), "split frames: wrong frame");
+    ++delivered;
+  };
+
+  // Cut inside the length prefix, inside the first payload, and between the frames mid-way into the second
+  const std::size_t cuts[]{2, first_frame / 2, first_frame + 3, bytes.size()};
+  const std::size_t expected[]{0, 0, 1, 2};
+  std::size_t       sent{0};
+  for (std::size_t c{0}; c < 4; ++c) {
+    producer.write(bytes.data() + sent, cuts[c] - sent);
+    sent = cuts[c];
+    poll_until(server, on_frame, [&] { return delivered >= expected[c] && server.total_connections() == 1; });
+    for (int i{0}; i < 3; ++i) { server.poll(on_frame, 10); }  // Nothing more may arrive from a partial frame
+    check(delivered == expected[c], "split frames: " + std::to_string(delivered) + " frames after " +
+                                        std::to_string(sent) + " bytes, expected " + std::to_string(expected[c]));
+  }
+  check(server.protocol_errors() == 0, "split frames: protocol errors on a well-formed stream");
+}
+
+void corrupt_prefixes(const std::string& path) {
+  IngestServer server{IngestEndpoint::parse("unix:" + path)};
+  std::size_t  delivered{0};
+  const auto   on_frame = [&delivered](const SharedFrame&) { ++delivered; };
+
+  // A length within bounds whose payload does not decode: the frame is dropped, the connection stays open
+  RawProducer                bad_payload{path};
+  std::vector<unsigned char> bytes;
+  encode_frame(make_frame(1), bytes);
+  const std::int32_t wrong_count{3};  // Payload holds 4 readings
+  std::memcpy(&bytes[frame_header_bytes + sizeof(std::int32_t)], &wrong_count, sizeof(wrong_count));
+  encode_frame(make_frame(2), bytes);
+  bad_payload.write(bytes.data(), bytes.size());
+  poll_until(server, on_frame, [&] { return delivered == 1 && server.protocol_errors() == 1; });
+  check(delivered == 1, "corrupt payload: the following well-formed frame was not delivered");
+  check(server.protocol_errors() == 1, "corrupt payload: not counted as a protocol error");
+  check(server.active_connections() == 1, "corrupt payload: producer disconnected");
+
+  // An oversized length prefix: nothing after it can be framed, so the producer is dropped
+  RawProducer oversized{path};
+  bytes.clear();
+  encode_frame(make_frame(3), bytes);
+  const std::uint32_t too_long{static_cast<std::uint32_t>(frame_max_payload_bytes + 1)};
+  const auto*         prefix = reinterpret_cast<const unsigned char*>(&too_long);
+  bytes.insert(bytes.end(), prefix, prefix + sizeof(too_long));
+  encode_frame(make_frame(4), bytes);  // Never delivered: follows the bad prefix
+  oversized.write(bytes.data(), bytes.size());
+  poll_until(server, on_frame, [&] { return server.protocol_errors() == 2 && server.active_connections() == 1; });
+  check(delivered == 2, "oversized prefix: " + std::to_string(delivered) + " frames delivered, expected 2");
+  check(server.protocol_errors() == 2, "oversized prefix: not counted as a protocol error");
+  check(server.active_connections() == 1, "oversized prefix: producer not dropped, or the other producer was");
+}
+}  // namespace
+
+int main() {
+  const std::string path = "/tmp/rwa2_ingest_test_" + std::to_string(getpid()) + ".sock";
+  try {
+    concurrent_producers(path);
+    split_frames(path);
+    corrupt_prefixes(path);
+  } catch (const std::exception& e) {
+    std::cerr << "FAILED: " << e.what() << '\n';
+    ++failures;
+  }
+
+  if (failures == 0) { std::cout << "ingest_server_test: all checks passed\n"; }
+  return failures == 0 ? 0 : 1;
+}
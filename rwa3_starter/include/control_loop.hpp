@@ -0,0 +1,154 @@
+/**
+ * @file control_loop.hpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Fixed-rate real-time control loop: absolute-deadline clock_nanosleep scheduling, optional CPU pinning and
+ *         memory locking, wake-up jitter / overrun histograms and a heap-allocation guard for the loop body
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <sched.h>
+
+
+/**
+ * @brief Log-linear histogram of nanosecond durations: 16 sub-buckets per power of two (~6% resolution), fixed
+ *        storage so recording never allocates
+ * 
+ */
+class JitterHistogram {
+public:
+    static constexpr unsigned    k_sub_bits{4};
+    static constexpr std::size_t k_bucket_count{64 << k_sub_bits};
+
+    void record(std::uint64_t ns);
+    void clear() { *this = JitterHistogram{}; }
+
+    std::uint64_t count() const { return count_; }
+    std::uint64_t max() const { return max_; }
+    double        mean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_); }
+
+    /**
+     * @brief Value at quantile q (0..1), reported as the upper edge of its bucket and capped at max()
+     * 
+     * @param q 
+     * @return std::uint64_t [ns]
+     */
+    std::uint64_t percentile(double q) const;
+
+private:
+    std::array<std::uint64_t, k_bucket_count> counts_{};
+    std::uint64_t                             count_{0};
+    std::uint64_t                             sum_{0};
+    std::uint64_t                             max_{0};
+};
+
+/**
+ * @brief Control loop settings
+ * 
+ */
+struct ControlLoopConfig {
+    std::chrono::nanoseconds period{1'000'000};  // 1 kHz
+    int                      cpu{-1};             // Pin the loop thread to this CPU for the run; -1 leaves it unpinned
+    bool                     lock_memory{false};  // mlockall() current and future pages so the loop never page-faults
+    bool                     forbid_allocations{true};  // Throw after the run if a step allocated on the heap
+};
+
+/**
+ * @brief Timing of a run
+ * 
+ */
+struct ControlLoopStats {
+    std::uint64_t   cycles{0};          // Steps executed
+    std::uint64_t   overruns{0};        // Steps that ended after the next deadline
+    std::uint64_t   missed_periods{0};  // Deadlines skipped because of overruns
+    std::uint64_t   allocations{0};     // Heap allocations made by the steps
+    JitterHistogram wake_latency;       // Wake-up time after each deadline [ns]
+    JitterHistogram step_time;          // Step execution time [ns]
+    JitterHistogram overrun;            // Time past the next deadline, for overrunning steps [ns]
+};
+
+namespace control_loop_detail {
+/**
+ * @brief Heap allocations made so far by the calling thread (counted by the global operator new)
+ * 
+ */
+std::uint64_t thread_allocations();
+}  // namespace control_loop_detail
+
+/**
+ * @brief Runs a step function once per period against absolute deadlines (CLOCK_MONOTONIC, TIMER_ABSTIME), so
+ *        sleep and step time never accumulate into drift. Overrunning steps skip the deadlines they missed and keep
+ *        the loop's phase.
+ * 
+ * The loop runs on the calling thread. All statistics live in preallocated storage; anything the step needs must be
+ * allocated before run().
+ */
+class ControlLoop {
+public:
+    explicit ControlLoop(ControlLoopConfig config = ControlLoopConfig{}) : config_{config} {}
+
+    /**
+     * @brief Call step(cycle, t) every period, up to cycles times
+     * 
+     * @tparam Step   bool(std::uint64_t cycle, double t): t is the scheduled time since the first deadline [s];
+     *                returning false stops the loop
+     * @param cycles 
+     * @param step 
+     * @return const ControlLoopStats& 
+     * @throws std::invalid_argument if the period is not positive
+     * @throws std::system_error if pinning or memory locking was requested and fails
+     * @throws std::logic_error if forbid_allocations is set and a step allocated
+     */
+    template <typename Step>
+    const ControlLoopStats& run(std::uint64_t cycles, Step&& step)
+    {
+        begin();
+        try {
+            for (std::uint64_t cycle{0}; cycle < cycles; ++cycle) {
+                wait();
+                const std::uint64_t allocations = control_loop_detail::thread_allocations();
+                const bool          keep_going  = step(cycle, scheduled_seconds());
+                stats_.allocations += control_loop_detail::thread_allocations() - allocations;
+                end_cycle();
+                if (!keep_going) {
+                    break;
+                }
+            }
+        } catch (...) {
+            restore();
+            throw;
+        }
+        restore();
+        check_allocations();
+        return stats_;
+    }
+
+    const ControlLoopStats&  stats() const { return stats_; }
+    const ControlLoopConfig& config() const { return config_; }
+
+private:
+    void   begin();
+    void   wait();
+    void   end_cycle();
+    void   restore();
+    void   check_allocations() const;
+    double scheduled_seconds() const;
+
+    ControlLoopConfig config_;
+    ControlLoopStats  stats_;
+    std::uint64_t     period_ns_{0};
+    std::uint64_t     start_ns_{0};     // First deadline [CLOCK_MONOTONIC ns]
+    std::uint64_t     periods_{0};      // Periods from the first deadline to the current one
+    std::uint64_t     deadline_ns_{0};  // Deadline of the current cycle
+    std::uint64_t     woke_ns_{0};      // Wake-up time of the current cycle
+    bool              pinned_{false};
+    bool              locked_{false};
+    cpu_set_t         saved_affinity_{};  // Affinity of the thread before pinning
+};
@@ -1,7 +1,7 @@
 /**
  * @file    robot_control.hpp
  * @author  Chris Collins (ccollin5@umd.edu)
- * @brief   Simple 2 DoF Robot Arm Control Header: Define Linear Interpolation Template and Define Trajectory Filter Function
+ * @brief   Simple 2 DoF Robot Arm Control Header: Define Linear Interpolation Template and Trajectory Filter Templates
  * @version 0.1
  * @date    2025-10-25
  * 
@@ -10,8 +10,13 @@
  */
 #pragma once
 #include "robot_types.hpp"
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <functional>
 
 
 /**
@@ -45,9 +50,308 @@ State interpolate_linear(const State& start, const State& goal, double alpha, in
 /**
  * @brief Takes Trajectory and applies given filter function to each JointState in Trajectory
  * 
+ * The filter is any callable State(const State&) and is called directly, so it inlines into the loop.
  *
+ * @tparam State 
+ * @tparam Filter 
  * @param traj 
  * @param filter 
  **/
-void apply_filter(std::vector<JointState>& traj,
-                  std::function<JointState(const JointState&)> filter);
+template <typename State, typename Filter>
+void apply_filter(std::vector<State>& traj, Filter&& filter)
+{   // Loop through each State in traj and apply filter
+    for (auto& s : traj) {
+        s = filter(s);
+    }
+}
+
+/**
+ * @brief Takes Trajectory and applies a chain of filters, in order, in a single pass: each JointState goes through
+ *        every filter before the next one is read, so the trajectory is loaded and stored once
+ * 
+ * @tparam State 
+ * @tparam Filters 
+ * @param traj 
+ * @param filters 
+ */
+template <typename State, typename... Filters>
+void apply_filters(std::vector<State>& traj, Filters&&... filters)
+{
+    for (auto& s : traj) {
+        ((s = filters(s)), ...);
+    }
+}
+
+/**
+ * @brief Applies a filter to every Joint State of a structure-of-arrays batch. The filter still sees whole
+ *        JointStates; once it is inlined, the loads and stores are contiguous per field, so simple filters vectorize.
+ * 
+ * @tparam Filter 
+ * @param batch 
+ * @param filter 
+ */
+template <typename Filter>
+void apply_filter(JointStateBatch& batch, Filter&& filter)
+{
+    double* const     theta1  = batch.theta1.data();
+    double* const     theta2  = batch.theta2.data();
+    double* const     dtheta1 = batch.dtheta1.data();
+    double* const     dtheta2 = batch.dtheta2.data();
+    const std::size_t n       = batch.size();
+    for (std::size_t i{0}; i < n; ++i) {
+        const JointState out = filter(JointState{theta1[i], theta2[i], dtheta1[i], dtheta2[i]});
+        theta1[i]  = out.theta1;
+        theta2[i]  = out.theta2;
+        dtheta1[i] = out.dtheta1;
+        dtheta2[i] = out.dtheta2;
+    }
+}
+
+/**
+ * @brief Chain of filters stored by value and used as one filter: calling it applies every stage in order
+ * 
+ * A pipeline is itself a filter, so it can be passed to apply_filter() or nested in another pipeline.
+ *
+ * @tparam Filters 
+ */
+template <typename... Filters>
+class FilterPipeline {
+public:
+    explicit FilterPipeline(Filters... filters) : filters_{std::move(filters)...} {}
+
+    template <typename State>
+    State operator()(State s)
+    {
+        return apply(filters_, s, std::index_sequence_for<Filters...>{});
+    }
+
+    template <typename State>
+    State operator()(State s) const
+    {
+        return apply(filters_, s, std::index_sequence_for<Filters...>{});
+    }
+
+    /**
+     * @brief Pipeline with next appended as the last stage
+     * 
+     * @tparam Next 
+     * @param next 
+     * @return FilterPipeline<Filters..., std::decay_t<Next>> 
+     */
+    template <typename Next>
+    FilterPipeline<Filters..., std::decay_t<Next>> then(Next&& next) const
+    {
+        return std::apply([&next](const Filters&... filters) {
+            return FilterPipeline<Filters..., std::decay_t<Next>>{filters..., std::forward<Next>(next)};
+        }, filters_);
+    }
+
+private:
+    template <typename Tuple, typename State, std::size_t... I>
+    static State apply(Tuple& filters, State s, std::index_sequence<I...>)
+    {
+        ((s = std::get<I>(filters)(s)), ...);
+        return s;
+    }
+
+    std::tuple<Filters...> filters_;
+};
+
+/**
+ * @brief Build a FilterPipeline from any callables (copied or moved into the pipeline)
+ * 
+ * @tparam Filters 
+ * @param filters 
+ * @return FilterPipeline<std::decay_t<Filters>...> 
+ */
+template <typename... Filters>
+FilterPipeline<std::decay_t<Filters>...> make_filter_pipeline(Filters&&... filters)
+{
+    return FilterPipeline<std::decay_t<Filters>...>{std::forward<Filters>(filters)...};
+}
+
+
+/**
+ * @brief Filter that returns its input; the filter of an unfiltered trajectory view
+ * 
+ */
+struct IdentityFilter {
+    template <typename State>
+    State operator()(const State& s) const { return s; }
+};
+
+/**
+ * @brief Lazy linear trajectory: a random-access range whose samples are computed with interpolate_linear() on
+ *        access from start, goal and the sample count, so a trajectory of any length takes O(1) memory
+ * 
+ * A view covers samples first, first + step, first + 2 step, ... of the full trajectory; slice() and stride() narrow
+ * it and filtered() applies a filter to every sample on access. Filters of a view are called on every access, so they
+ * should be stateless.
+ *
+ * @tparam State 
+ * @tparam Filter 
+ */
+template <typename State, typename Filter = IdentityFilter>
+class LinearTrajectoryView {
+public:
+    /**
+     * @brief Random-access iterator over a view. Dereferencing computes the sample, so reference is a value.
+     * 
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = State;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = State;
+
+        const_iterator() = default;
+        const_iterator(const LinearTrajectoryView* view, std::size_t i) : view_{view}, i_{i} {}
+
+        State operator*() const { return (*view_)[i_]; }
+        State operator[](difference_type n) const { return (*view_)[i_ + n]; }
+
+        const_iterator& operator++() { ++i_; return *this; }
+        const_iterator& operator--() { --i_; return *this; }
+        const_iterator  operator++(int) { const_iterator out{*this}; ++i_; return out; }
+        const_iterator  operator--(int) { const_iterator out{*this}; --i_; return out; }
+        const_iterator& operator+=(difference_type n) { i_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { i_ -= n; return *this; }
+
+        friend const_iterator  operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator  operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator  operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b)
+        {
+            return static_cast<difference_type>(a.i_) - static_cast<difference_type>(b.i_);
+        }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.i_ == b.i_; }
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.i_ != b.i_; }
+        friend bool operator<(const const_iterator& a, const const_iterator& b) { return a.i_ < b.i_; }
+        friend bool operator>(const const_iterator& a, const const_iterator& b) { return a.i_ > b.i_; }
+        friend bool operator<=(const const_iterator& a, const const_iterator& b) { return a.i_ <= b.i_; }
+        friend bool operator>=(const const_iterator& a, const const_iterator& b) { return a.i_ >= b.i_; }
+
+    private:
+        const LinearTrajectoryView* view_{nullptr};
+        std::size_t                 i_{0};
+    };
+
+    /**
+     * @brief View of every sample of the trajectory from start to goal
+     * 
+     * @param start 
+     * @param goal 
+     * @param num_samples  Number of Trajectory Points, includes endpoints
+     * @param filter       Applied to every sample on access
+     * @throws std::invalid_argument if num_samples < 2
+     */
+    LinearTrajectoryView(const State& start, const State& goal, int num_samples, Filter filter = Filter{})
+        : start_{start}, goal_{goal}, num_samples_{num_samples},
+          alpha_step_{1.0 / (num_samples - 1)},  // Same step as k_alpha_step, so samples match a materialized loop
+          count_{static_cast<std::size_t>(num_samples)}, filter_{std::move(filter)}
+    {
+        if (num_samples < 2) {
+            throw std::invalid_argument{"a linear trajectory needs at least 2 samples"};
+        }
+    }
+
+    std::size_t size() const { return count_; }
+    bool        empty() const { return count_ == 0; }
+
+    /**
+     * @brief Index of element i of this view in the full trajectory
+     * 
+     * @param i 
+     * @return std::size_t 
+     */
+    std::size_t sample_index(std::size_t i) const { return first_ + i * step_; }
+
+    /**
+     * @brief Element i of this view, computed on access (no bounds check)
+     * 
+     * @param i 
+     * @return State 
+     */
+    State operator[](std::size_t i) const
+    {
+        const double alpha = static_cast<double>(sample_index(i)) * alpha_step_;
+        return filter_(interpolate_linear(start_, goal_, alpha, num_samples_));
+    }
+
+    State front() const { return (*this)[0]; }
+    State back() const { return (*this)[count_ - 1]; }
+
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, count_}; }
+
+    /**
+     * @brief Elements [first, last) of this view
+     * 
+     * @param first 
+     * @param last 
+     * @return LinearTrajectoryView 
+     * @throws std::out_of_range if first > last or last > size()
+     */
+    LinearTrajectoryView slice(std::size_t first, std::size_t last) const
+    {
+        if (first > last || last > count_) {
+            throw std::out_of_range{"trajectory slice out of range"};
+        }
+        LinearTrajectoryView out{*this};
+        out.first_ = sample_index(first);
+        out.count_ = last - first;
+        return out;
+    }
+
+    /**
+     * @brief Every step-th element of this view, starting with the first
+     * 
+     * @param step 
+     * @return LinearTrajectoryView 
+     * @throws std::invalid_argument if step is 0
+     */
+    LinearTrajectoryView stride(std::size_t step) const
+    {
+        if (step == 0) {
+            throw std::invalid_argument{"trajectory stride must be positive"};
+        }
+        LinearTrajectoryView out{*this};
+        out.step_  = step_ * step;
+        out.count_ = (count_ + step - 1) / step;
+        return out;
+    }
+
+    /**
+     * @brief This view with next applied after the current filter to every element on access
+     * 
+     * @tparam Next 
+     * @param next 
+     * @return LinearTrajectoryView<State, FilterPipeline<Filter, std::decay_t<Next>>> 
+     */
+    template <typename Next>
+    LinearTrajectoryView<State, FilterPipeline<Filter, std::decay_t<Next>>> filtered(Next&& next) const
+    {
+        using Pipeline = FilterPipeline<Filter, std::decay_t<Next>>;
+        LinearTrajectoryView<State, Pipeline> out{start_, goal_, num_samples_,
+                                                  Pipeline{filter_, std::forward<Next>(next)}};
+        out.first_ = first_;
+        out.step_  = step_;
+        out.count_ = count_;
+        return out;
+    }
+
+private:
+    template <typename, typename>
+    friend class LinearTrajectoryView;
+
+    State       start_;
+    State       goal_;
+    int         num_samples_;
+    double      alpha_step_;
+    std::size_t first_{0};  // Full-trajectory index of element 0
+    std::size_t step_{1};   // Full-trajectory indices between elements
+    std::size_t count_;
+    Filter      filter_;
+};
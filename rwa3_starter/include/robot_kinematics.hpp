@@ -1,7 +1,7 @@
 /**
  * @file robot_kinematics.hpp
  * @author Chris Collins (ccollin5@umd.edu)
- * @brief Calculate Forward Kinematics of 2 DoF Robot Arm
+ * @brief Calculate Forward and Inverse Kinematics of 2 DoF Robot Arm, and Forward Kinematics of N-link arms
  * @version 0.1
  * @date 2025-10-25
  * 
@@ -10,11 +10,100 @@
  */
 #pragma once
 #include "robot_types.hpp"
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
+inline constexpr double k_sincos_max_arg{1.0e5};  // Larger |angles| fall back to std::sin/std::cos [rad]
+inline constexpr double k_ik_reach_tol{1.0e-9};    // Slack on cos(θ2) so workspace-boundary targets are reachable
+
+
+namespace arm {
+namespace detail {
+// links by value: short arrays travel in registers and fold into the unrolled chain
+template <std::size_t N, typename Scalar, std::size_t... I>
+PlanarPose<Scalar> planar_chain(const JointState<N, Scalar>& s, std::array<Scalar, N> links,
+                                std::index_sequence<I...>)
+{
+    Scalar             phi  = s.template angle<0>();  // Absolute angle of the current link
+    PlanarPose<Scalar> pose{links[0] * std::cos(phi), links[0] * std::sin(phi)};
+    ((phi += s.template angle<I + 1>(),
+      pose.x += links[I + 1] * std::cos(phi),
+      pose.y += links[I + 1] * std::sin(phi)), ...);
+    return pose;
+}
+
+// T = T * A(θ), A the DH transform of link
+template <typename Scalar>
+inline void dh_step(Transform<Scalar>& T, Scalar theta, const DHLink<Scalar>& link)
+{
+    const Scalar ct = std::cos(theta + link.theta_offset);
+    const Scalar st = std::sin(theta + link.theta_offset);
+    const Scalar ca = std::cos(link.alpha);
+    const Scalar sa = std::sin(link.alpha);
+    for (std::size_t r{0}; r < 3; ++r) {
+        const Scalar r0 = T.rotation[3 * r];
+        const Scalar r1 = T.rotation[3 * r + 1];
+        const Scalar r2 = T.rotation[3 * r + 2];
+        T.rotation[3 * r]     = r0 * ct + r1 * st;
+        T.rotation[3 * r + 1] = (r1 * ct - r0 * st) * ca + r2 * sa;
+        T.rotation[3 * r + 2] = (r0 * st - r1 * ct) * sa + r2 * ca;
+        T.position[r] += link.a * (r0 * ct + r1 * st) + link.d * r2;
+    }
+}
+
+template <std::size_t N, typename Scalar, std::size_t... I>
+Transform<Scalar> dh_chain(const JointState<N, Scalar>& s, const std::array<DHLink<Scalar>, N>& links,
+                           std::index_sequence<I...>)
+{
+    Transform<Scalar> T{};
+    (dh_step(T, s.template angle<I>(), links[I]), ...);
+    return T;
+}
+}  // namespace detail
 
 /**
- * @brief Calculate Forward Kinematics of 2 DoF Robot Arm
+ * @brief Forward Kinematics of an N-link planar Robot Arm: every joint rotates about z, link i points along the sum
+ *        of the first i + 1 joint angles
+ * 
+ * The chain is unrolled at compile time; with constexpr link lengths every multiply folds to a constant.
+ * 
+ * @tparam N 
+ * @tparam Scalar 
+ * @param s 
+ * @param links  Link lengths [m]
+ * @return PlanarPose<Scalar> 
+ */
+template <std::size_t N, typename Scalar>
+PlanarPose<Scalar> forward_kinematics(const JointState<N, Scalar>& s, const std::array<Scalar, N>& links)
+{
+    static_assert(N >= 1, "a planar arm has at least one link");
+    return detail::planar_chain(s, links, std::make_index_sequence<N - 1>{});
+}
+
+/**
+ * @brief Forward Kinematics of an N DoF revolute Robot Arm from standard Denavit-Hartenberg parameters
+ * 
+ * The chain of link transforms is unrolled at compile time; with constexpr parameters the link twists' sines and
+ * cosines fold to constants.
+ * 
+ * @tparam N 
+ * @tparam Scalar 
+ * @param s 
+ * @param links  DH parameters, base to end effector
+ * @return Transform<Scalar>  End effector frame in the base frame
+ */
+template <std::size_t N, typename Scalar>
+Transform<Scalar> forward_kinematics_dh(const JointState<N, Scalar>& s, const std::array<DHLink<Scalar>, N>& links)
+{
+    return detail::dh_chain(s, links, std::make_index_sequence<N>{});
+}
+}  // namespace arm
+
+/**
+ * @brief Calculate Forward Kinematics of 2 DoF Robot Arm (the 2-link instantiation of arm::forward_kinematics)
  * 
  * @tparam State 
  * @param s 
@@ -27,8 +116,91 @@ EndEffectorPose forward_kinematics(const State& s,
                                    double L1 = k_link1,
                                    double L2 = k_link2)
 {
-    EndEffectorPose pose{};
-    pose.x = L1*std::cos(s.theta1) + L2*std::cos(s.theta1 + s.theta2);
-    pose.y = L1*std::sin(s.theta1) + L2*std::sin(s.theta1 + s.theta2);
-    return pose;
-}
\ No newline at end of file
+    return arm::forward_kinematics(JointState{s.theta1, s.theta2}, std::array<double, 2>{L1, L2});
+}
+
+
+/**
+ * @brief Sine and cosine of n angles. One range reduction per angle (to [-pi/4, pi/4] by quadrant) is shared by
+ *        both polynomials, and the loop has no branches or libm calls so it vectorizes.
+ * 
+ * Accurate to a few ulp for |angle| <= k_sincos_max_arg; larger angles are recomputed with std::sin/std::cos.
+ * 
+ * @param angles   Input angles [rad]
+ * @param n        Number of angles
+ * @param sin_out  sin(angles[i])
+ * @param cos_out  cos(angles[i])
+ */
+void sincos_batch(const double* angles, std::size_t n, double* sin_out, double* cos_out);
+
+/**
+ * @brief Batched Forward Kinematics of 2 DoF Robot Arm over structure-of-arrays joint angles
+ * 
+ * @param theta1  Joint 1 angles [rad]
+ * @param theta2  Joint 2 angles [rad]
+ * @param n       Number of joint states
+ * @param x       End effector x [m]
+ * @param y       End effector y [m]
+ * @param L1 
+ * @param L2 
+ */
+void forward_kinematics_batch(const double* theta1, const double* theta2, std::size_t n, double* x, double* y,
+                              double L1 = k_link1, double L2 = k_link2);
+
+/**
+ * @brief Batched Forward Kinematics of 2 DoF Robot Arm for every Joint State in a batch
+ * 
+ * @param states 
+ * @param poses   Resized to states.size()
+ * @param L1 
+ * @param L2 
+ */
+void forward_kinematics_batch(const JointStateBatch& states, EndEffectorPoseBatch& poses,
+                              double L1 = k_link1, double L2 = k_link2);
+
+
+/**
+ * @brief Closed-form Inverse Kinematics of 2 DoF Robot Arm: both elbow configurations of a target pose
+ * 
+ * cos(θ2) = (x² + y² - L1² - L2²) / (2 L1 L2), θ2 = ±acos, θ1 = atan2(y, x) - atan2(L2 sin θ2, L1 + L2 cos θ2).
+ * Returned joint velocities are zero.
+ * 
+ * @param target 
+ * @param L1 
+ * @param L2 
+ * @return IKSolution  reachable is false when the target is closer than |L1 - L2| or farther than L1 + L2
+ */
+IKSolution inverse_kinematics(const EndEffectorPose& target, double L1 = k_link1, double L2 = k_link2);
+
+/**
+ * @brief Batched Inverse Kinematics of 2 DoF Robot Arm over structure-of-arrays target poses
+ * 
+ * Same solutions as inverse_kinematics(), to a few ulp, with a branch-free atan2 so the loop vectorizes.
+ * 
+ * @param x            Target x [m]
+ * @param y            Target y [m]
+ * @param n            Number of targets
+ * @param theta1_up    Elbow-up joint 1 angles [rad]
+ * @param theta2_up    Elbow-up joint 2 angles [rad]
+ * @param theta1_down  Elbow-down joint 1 angles [rad]
+ * @param theta2_down  Elbow-down joint 2 angles [rad]
+ * @param reachable    1 if the target is inside the workspace, else 0
+ * @param L1 
+ * @param L2 
+ * @return std::size_t Number of reachable targets
+ */
+std::size_t inverse_kinematics_batch(const double* x, const double* y, std::size_t n, double* theta1_up,
+                                     double* theta2_up, double* theta1_down, double* theta2_down,
+                                     std::uint8_t* reachable, double L1 = k_link1, double L2 = k_link2);
+
+/**
+ * @brief Batched Inverse Kinematics of 2 DoF Robot Arm for every pose in a batch
+ * 
+ * @param targets 
+ * @param solutions  Resized to targets.size(); joint velocities are zero
+ * @param L1 
+ * @param L2 
+ * @return std::size_t Number of reachable targets
+ */
+std::size_t inverse_kinematics_batch(const EndEffectorPoseBatch& targets, IKSolutionBatch& solutions,
+                                     double L1 = k_link1, double L2 = k_link2);
@@ -9,29 +9,199 @@
  * 
  */
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 
+namespace arm {
 /**
- * @brief Define 2-D Robot Joint State for 2 DoF Robot Arm
+ * @brief Joint State of an N DoF Robot Arm
+ * 
+ * Generic code reads joints through angle<I>() / velocity<I>(), which the 2 DoF specialization maps to its named
+ * fields, so kinematic chains unroll at compile time for any N.
  * 
+ * @tparam N       Number of joints
+ * @tparam Scalar  Floating-point type
  */
+template <std::size_t N, typename Scalar = double>
 struct JointState {
-    double theta1;        // Joint 1 angle [rad]
-    double theta2;        // Joint 2 angle [rad]
+    static constexpr std::size_t dof{N};
+
+    std::array<Scalar, N> theta{};   // Joint angles [rad]
+    std::array<Scalar, N> dtheta{};  // Joint velocities [rad/s]
+
+    template <std::size_t I>
+    constexpr Scalar angle() const { return std::get<I>(theta); }
+
+    template <std::size_t I>
+    constexpr Scalar velocity() const { return std::get<I>(dtheta); }
+};
+
+/**
+ * @brief Define 2-D Robot Joint State for 2 DoF Robot Arm
+ * 
+ */
+template <typename Scalar>
+struct JointState<2, Scalar> {
+    static constexpr std::size_t dof{2};
+
+    Scalar theta1;        // Joint 1 angle [rad]
+    Scalar theta2;        // Joint 2 angle [rad]
     
     // Initialize Default Velocities to zero
-    double dtheta1 = 0.0; // Joint 1 velocity [rad/s]
-    double dtheta2 = 0.0; // Joint 2 velocity [rad/s]
+    Scalar dtheta1 = 0.0; // Joint 1 velocity [rad/s]
+    Scalar dtheta2 = 0.0; // Joint 2 velocity [rad/s]
+
+    template <std::size_t I>
+    constexpr Scalar angle() const
+    {
+        static_assert(I < 2, "joint index out of range");
+        if constexpr (I == 0) {
+            return theta1;
+        } else {
+            return theta2;
+        }
+    }
+
+    template <std::size_t I>
+    constexpr Scalar velocity() const
+    {
+        static_assert(I < 2, "joint index out of range");
+        if constexpr (I == 0) {
+            return dtheta1;
+        } else {
+            return dtheta2;
+        }
+    }
 };
 
 /**
- * @brief Define 2-D Robot End Effector Pose for 2 DoF Robot Arm
+ * @brief Define 2-D End Effector Pose of a planar Robot Arm
  * 
  */
-struct EndEffectorPose {
-    double x; // [m]
-    double y; // [m]
+template <typename Scalar = double>
+struct PlanarPose {
+    Scalar x; // [m]
+    Scalar y; // [m]
+};
+
+/**
+ * @brief Standard Denavit-Hartenberg parameters of one revolute joint: Rot_z(θ + theta_offset) Trans_z(d)
+ *        Trans_x(a) Rot_x(alpha)
+ * 
+ */
+template <typename Scalar = double>
+struct DHLink {
+    Scalar a;                // Link length [m]
+    Scalar alpha;            // Link twist [rad]
+    Scalar d;                // Link offset [m]
+    Scalar theta_offset{0};  // Added to the joint angle [rad]
+};
+
+/**
+ * @brief Rigid transform of the end effector in the base frame
+ * 
+ */
+template <typename Scalar = double>
+struct Transform {
+    std::array<Scalar, 9> rotation{1, 0, 0, 0, 1, 0, 0, 0, 1};  // Row-major 3x3
+    std::array<Scalar, 3> position{};                           // [m]
+};
+}  // namespace arm
+
+using JointState      = arm::JointState<2>;  // 2 DoF Robot Arm Joint State
+using EndEffectorPose = arm::PlanarPose<>;   // 2 DoF Robot Arm End Effector Pose
+
+/**
+ * @brief Structure-of-arrays batch of Joint States: one contiguous array per field, so batched kinematics can
+ *        stream theta1/theta2 through vector registers
+ * 
+ */
+struct JointStateBatch {
+    std::vector<double> theta1;   // Joint 1 angles [rad]
+    std::vector<double> theta2;   // Joint 2 angles [rad]
+    std::vector<double> dtheta1;  // Joint 1 velocities [rad/s]
+    std::vector<double> dtheta2;  // Joint 2 velocities [rad/s]
+
+    std::size_t size() const { return theta1.size(); }
+
+    void reserve(std::size_t n) {
+        theta1.reserve(n);
+        theta2.reserve(n);
+        dtheta1.reserve(n);
+        dtheta2.reserve(n);
+    }
+
+    void resize(std::size_t n) {
+        theta1.resize(n);
+        theta2.resize(n);
+        dtheta1.resize(n);
+        dtheta2.resize(n);
+    }
+
+    void clear() { resize(0); }
+
+    void push_back(const JointState& js) {
+        theta1.push_back(js.theta1);
+        theta2.push_back(js.theta2);
+        dtheta1.push_back(js.dtheta1);
+        dtheta2.push_back(js.dtheta2);
+    }
+
+    JointState operator[](std::size_t i) const { return {theta1[i], theta2[i], dtheta1[i], dtheta2[i]}; }
+};
+
+/**
+ * @brief Structure-of-arrays batch of End Effector Poses
+ * 
+ */
+struct EndEffectorPoseBatch {
+    std::vector<double> x;  // [m]
+    std::vector<double> y;  // [m]
+
+    std::size_t size() const { return x.size(); }
+
+    void resize(std::size_t n) {
+        x.resize(n);
+        y.resize(n);
+    }
+
+    EndEffectorPose operator[](std::size_t i) const { return {x[i], y[i]}; }
+};
+
+/**
+ * @brief Both Inverse Kinematics solutions of the 2 DoF Robot Arm for one target pose
+ * 
+ * Elbow-up has θ2 <= 0 (elbow on the counter-clockwise side of the base-to-target line), elbow-down has θ2 >= 0.
+ * For an unreachable target both solutions stretch (or fold) the arm towards it and reachable is false.
+ */
+struct IKSolution {
+    JointState elbow_up;
+    JointState elbow_down;
+    bool       reachable;
+};
+
+/**
+ * @brief Structure-of-arrays batch of Inverse Kinematics solutions
+ * 
+ */
+struct IKSolutionBatch {
+    JointStateBatch           elbow_up;
+    JointStateBatch           elbow_down;
+    std::vector<std::uint8_t> reachable;  // 1 if the target is inside the workspace
+
+    std::size_t size() const { return reachable.size(); }
+
+    void resize(std::size_t n) {
+        elbow_up.resize(n);
+        elbow_down.resize(n);
+        reachable.resize(n);
+    }
+
+    IKSolution operator[](std::size_t i) const { return {elbow_up[i], elbow_down[i], reachable[i] != 0}; }
 };
 
 // Print function Definitions (implemented in main.cpp)
@@ -41,5 +211,6 @@ void print_pose(const EndEffectorPose& ps);
 inline constexpr double k_link1{0.5};        // Arm Length of Robot Link 1 [m]
 inline constexpr double k_link2{0.3};        // Arm Length of Robot Link 2 [m]
 inline constexpr double k_vel_limit{1.0};    // Robot Arm Angular Velocity Limit [rad/s]
+inline constexpr double k_accel_limit{2.0};  // Robot Arm Angular Acceleration Limit [rad/s^2]
 inline constexpr int    k_num_samples{21};   // Number of Trajectory Points, includes endpoints
 inline constexpr double k_alpha_step{1.0 / (k_num_samples - 1)}; // Step size for interpolation 
@@ -0,0 +1,83 @@
+/**
+ * @file thread_pool.hpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Persistent worker threads that run a batch of indexed tasks; the calling thread takes part
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * @brief Fixed set of worker threads, started once and reused by every run()
+ * 
+ * run() hands out task indices dynamically, so uneven tasks balance across threads. Which thread runs a task is not
+ * deterministic; callers that need deterministic results write each task's output to its own slot.
+ * One run() at a time: the pool is driven from a single thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Start threads - 1 workers (the calling thread is the last one)
+     * 
+     * @param threads  Total threads, including the caller; 0 or 1 runs every task on the caller
+     */
+    explicit ThreadPool(std::size_t threads = std::max(1U, std::thread::hardware_concurrency()));
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return workers_.size() + 1; }
+
+    /**
+     * @brief Call fn(task) for every task in [0, tasks) across the pool and return once all have finished
+     * 
+     * @tparam Fn 
+     * @param tasks 
+     * @param fn     Callable taking std::size_t; called concurrently
+     * @throws The first exception thrown by fn, after every task has finished
+     */
+    template <typename Fn>
+    void run(std::size_t tasks, Fn&& fn)
+    {
+        using Callable = std::remove_reference_t<Fn>;
+        run_tasks(tasks, [](void* context, std::size_t task) { (*static_cast<Callable*>(context))(task); },
+                  const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+private:
+    using TaskFn = void (*)(void*, std::size_t);  // Type-erased task, no allocation per run()
+
+    void run_tasks(std::size_t tasks, TaskFn fn, void* context);
+    void worker_loop();
+    void work();
+
+    std::vector<std::thread> workers_;
+
+    std::mutex              mutex_;  // Guards the members below, except next_
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    TaskFn                  fn_{nullptr};
+    void*                   context_{nullptr};
+    std::size_t             tasks_{0};
+    std::size_t             busy_workers_{0};  // Workers still inside the current run
+    std::uint64_t           generation_{0};    // Incremented per run so each worker joins it once
+    bool                    stop_{false};
+    std::exception_ptr      error_;
+
+    std::atomic<std::size_t> next_{0};  // Next unclaimed task
+};
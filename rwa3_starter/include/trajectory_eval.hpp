@@ -0,0 +1,86 @@
+/**
+ * @file trajectory_eval.hpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Parallel evaluation of long trajectories: interpolation, filtering and Forward Kinematics of every sample,
+ *         split into fixed chunks across a thread pool
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+#include "robot_kinematics.hpp"
+#include "robot_types.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+inline constexpr std::size_t k_traj_chunk{4096};  // Samples per parallel task, independent of the thread count
+inline constexpr std::size_t k_traj_block{256};   // Samples per batched FK call within a task (stack buffers)
+
+
+/**
+ * @brief Interpolate, filter and compute the End Effector Pose of every sample of a trajectory view
+ * 
+ * Outputs are resized once up front and every chunk of k_traj_chunk samples writes only its own slice of them, so
+ * chunks run on any thread without synchronization. Each chunk counts the samples the filter changed in its own
+ * slot; the slots are summed in chunk order afterwards.
+ * 
+ * @tparam View    Random-access trajectory (e.g. LinearTrajectoryView) whose elements are JointStates
+ * @tparam Filter  JointState(const JointState&); called concurrently, so it must be thread-safe
+ * @param pool 
+ * @param traj 
+ * @param filter 
+ * @param poses    Resized to traj.size(); pose of each filtered sample
+ * @param states   Resized to traj.size() and filled with the filtered samples, unless null
+ * @param L1 
+ * @param L2 
+ * @return std::size_t Number of samples the filter changed
+ */
+template <typename View, typename Filter>
+std::size_t evaluate_trajectory(ThreadPool& pool, const View& traj, const Filter& filter, EndEffectorPoseBatch& poses,
+                                JointStateBatch* states = nullptr, double L1 = k_link1, double L2 = k_link2)
+{
+    const std::size_t n      = traj.size();
+    const std::size_t chunks = (n + k_traj_chunk - 1) / k_traj_chunk;
+    poses.resize(n);
+    if (states != nullptr) {
+        states->resize(n);
+    }
+    std::vector<std::size_t> changed(chunks, 0);
+
+    pool.run(chunks, [&](std::size_t chunk) {
+        const std::size_t first = chunk * k_traj_chunk;
+        const std::size_t last  = std::min(n, first + k_traj_chunk);
+        double            theta1[k_traj_block];
+        double            theta2[k_traj_block];
+        std::size_t       count{0};
+        for (std::size_t block{first}; block < last; block += k_traj_block) {
+            const std::size_t m = std::min(k_traj_block, last - block);
+            for (std::size_t j{0}; j < m; ++j) {
+                const JointState in  = traj[block + j];
+                const JointState out = filter(in);
+                count += (out.theta1 != in.theta1 || out.theta2 != in.theta2 || out.dtheta1 != in.dtheta1
+                          || out.dtheta2 != in.dtheta2) ? 1 : 0;
+                theta1[j] = out.theta1;
+                theta2[j] = out.theta2;
+                if (states != nullptr) {
+                    states->theta1[block + j]  = out.theta1;
+                    states->theta2[block + j]  = out.theta2;
+                    states->dtheta1[block + j] = out.dtheta1;
+                    states->dtheta2[block + j] = out.dtheta2;
+                }
+            }
+            forward_kinematics_batch(theta1, theta2, m, poses.x.data() + block, poses.y.data() + block, L1, L2);
+        }
+        changed[chunk] = count;
+    });
+
+    std::size_t total{0};
+    for (const std::size_t count : changed) {
+        total += count;
+    }
+    return total;
+}
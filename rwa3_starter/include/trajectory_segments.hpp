@@ -0,0 +1,182 @@
+/**
+ * @file trajectory_segments.hpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Precompiled joint trajectories: linear, cubic, quintic and trapezoidal-velocity segments compiled into
+ *         polynomial coefficient tables, sampled at any time with a direct piece lookup and Horner's scheme
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+#include "robot_types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief Motion profile of one segment between two Joint States
+ * 
+ */
+enum class SegmentProfile {
+    Linear,       // Constant velocity (start and goal velocities are ignored)
+    Cubic,        // Hermite cubic through the start and goal velocities (dtheta)
+    Quintic,      // Quintic through the start and goal velocities, zero acceleration at both ends
+    Trapezoidal,  // Rest to rest: constant acceleration, cruise, constant deceleration within velocity/accel limits
+};
+
+/**
+ * @brief Joint positions and velocities at a time, plus accelerations
+ * 
+ */
+struct TrajectorySample {
+    JointState state;     // θ [rad], dθ [rad/s]
+    double     ddtheta1;  // Joint 1 acceleration [rad/s^2]
+    double     ddtheta2;  // Joint 2 acceleration [rad/s^2]
+};
+
+/**
+ * @brief Compiled trajectory: a table of polynomial pieces in local time τ = t - t_start, with position, velocity and
+ *        acceleration coefficients precomputed per joint, and a uniform time-bin index into the pieces
+ * 
+ * Bins are no wider than the shortest piece, so a bin overlaps at most two pieces and sample() needs one lookup and
+ * one or two comparisons: no search, no per-sample setup. (Bins are capped at 2^20 per trajectory; beyond that, pieces
+ * shorter than a bin cost a short forward step each.)
+ */
+class CompiledTrajectory {
+public:
+    /**
+     * @brief Polynomial piece: joint j position is sum pos[j][k] τ^k, velocity sum vel[j][k] τ^k,
+     *        acceleration sum acc[j][k] τ^k
+     * 
+     */
+    struct Piece {
+        double                               t_start;
+        double                               t_end;
+        std::array<std::array<double, 6>, 2> pos;
+        std::array<std::array<double, 5>, 2> vel;
+        std::array<std::array<double, 4>, 2> acc;
+    };
+
+    double      duration() const { return duration_; }
+    std::size_t piece_count() const { return pieces_.size(); }
+
+    /**
+     * @brief Positions, velocities and accelerations at time t. Before the start and after the end the arm holds the
+     *        first / last position with zero velocity and acceleration.
+     * 
+     * @param t  [s]
+     * @return TrajectorySample 
+     */
+    TrajectorySample sample(double t) const
+    {
+        if (!(t >= 0.0 && t <= duration_)) {  // Outside the trajectory (or NaN)
+            return t > duration_ ? hold(pieces_.back(), duration_) : hold(pieces_.front(), 0.0);
+        }
+        std::size_t bin = static_cast<std::size_t>(t * inv_bin_width_);
+        bin             = bin < bin_piece_.size() ? bin : bin_piece_.size() - 1;
+        std::size_t i   = bin_piece_[bin];
+        while (t >= pieces_[i].t_end && i + 1 < pieces_.size()) {  // Bin straddles a piece boundary: at most once
+            ++i;                                                  // unless pieces outnumber the bins
+        }
+        while (t < pieces_[i].t_start && i > 0) {  // t rounded into the bin just after a boundary
+            --i;
+        }
+        return evaluate(pieces_[i], t - pieces_[i].t_start);
+    }
+
+private:
+    friend class TrajectoryBuilder;
+
+    static double horner(const double* c, std::size_t n, double tau)
+    {
+        double value = c[n - 1];
+        for (std::size_t k = n - 1; k > 0; --k) {
+            value = value * tau + c[k - 1];
+        }
+        return value;
+    }
+
+    static TrajectorySample evaluate(const Piece& piece, double tau)
+    {
+        TrajectorySample out{};
+        out.state.theta1  = horner(piece.pos[0].data(), 6, tau);
+        out.state.theta2  = horner(piece.pos[1].data(), 6, tau);
+        out.state.dtheta1 = horner(piece.vel[0].data(), 5, tau);
+        out.state.dtheta2 = horner(piece.vel[1].data(), 5, tau);
+        out.ddtheta1      = horner(piece.acc[0].data(), 4, tau);
+        out.ddtheta2      = horner(piece.acc[1].data(), 4, tau);
+        return out;
+    }
+
+    static TrajectorySample hold(const Piece& piece, double t)
+    {
+        TrajectorySample out{};
+        out.state.theta1 = horner(piece.pos[0].data(), 6, t - piece.t_start);
+        out.state.theta2 = horner(piece.pos[1].data(), 6, t - piece.t_start);
+        return out;
+    }
+
+    std::vector<Piece>         pieces_;
+    std::vector<std::uint32_t> bin_piece_;  // Piece containing the start of each time bin
+    double                     inv_bin_width_{0.0};
+    double                     duration_{0.0};
+};
+
+/**
+ * @brief Builds a CompiledTrajectory segment by segment; each segment starts where the previous one ended
+ * 
+ */
+class TrajectoryBuilder {
+public:
+    /**
+     * @brief Start at start (its dtheta is the initial velocity of a Cubic or Quintic first segment)
+     * 
+     * @param start 
+     */
+    explicit TrajectoryBuilder(const JointState& start) : current_{start} {}
+
+    /**
+     * @brief Append a Linear, Cubic or Quintic segment to goal
+     * 
+     * @param goal      Goal positions, and goal velocities for Cubic / Quintic
+     * @param duration  [s]
+     * @param profile 
+     * @return TrajectoryBuilder& 
+     * @throws std::invalid_argument if duration is not positive or profile is Trapezoidal
+     */
+    TrajectoryBuilder& append(const JointState& goal, double duration, SegmentProfile profile);
+
+    /**
+     * @brief Append a rest-to-rest Trapezoidal segment to goal in the shortest time the limits allow. Both joints
+     *        share the switching times of the slowest joint, so they start and stop together.
+     * 
+     * @param goal 
+     * @param max_velocity      Per-joint velocity limit [rad/s]
+     * @param max_acceleration  Per-joint acceleration limit [rad/s^2]
+     * @return TrajectoryBuilder& 
+     * @throws std::invalid_argument if a limit is not positive
+     */
+    TrajectoryBuilder& append_trapezoidal(const JointState& goal, double max_velocity = k_vel_limit,
+                                          double max_acceleration = k_accel_limit);
+
+    /**
+     * @brief Precompute the time-bin index and return the trajectory (the builder can keep appending afterwards)
+     * 
+     * @return CompiledTrajectory 
+     * @throws std::invalid_argument if no segment has been appended
+     */
+    CompiledTrajectory compile() const;
+
+private:
+    using Piece = CompiledTrajectory::Piece;
+
+    void add_piece(double duration, const std::array<std::array<double, 6>, 2>& pos);
+
+    JointState         current_;        // End of the trajectory so far
+    double             t_end_{0.0};     // [s]
+    std::vector<Piece> pieces_;
+};
@@ -0,0 +1,172 @@
+/**
+ * @file workspace_map.hpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Precomputed workspace grid of the 2 DoF arm: boundary clearance and both IK configurations at every node,
+ *         stored in square tiles, answering reachability, inverse and nearest-configuration queries with bilinear
+ *         interpolation; built in parallel and serializable
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+#include "robot_types.hpp"
+#include "thread_pool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+inline constexpr std::size_t k_workspace_resolution{256};  // Cells per side of the default grid
+inline constexpr std::size_t k_workspace_tile{8};          // Nodes per tile side: a tile is one parallel build task
+
+/**
+ * @brief Per-user workspace map cache file: $XDG_CACHE_HOME/rwa3/workspace_map.bin, or
+ *        $HOME/.cache/rwa3/workspace_map.bin when XDG_CACHE_HOME is unset or not an absolute path
+ * 
+ * @return std::string  Empty if neither variable names a usable directory
+ */
+std::string workspace_map_cache_path();
+
+/**
+ * @brief One grid node. Outside the workspace the angles are the fully stretched or folded arm pointing at the node,
+ *        as returned by inverse_kinematics().
+ * 
+ */
+struct WorkspaceNode {
+    float clearance;    // Distance inside the workspace boundary [m]; negative outside
+    float theta1_up;    // [rad]
+    float theta2_up;    // [rad]
+    float theta1_down;  // [rad]
+    float theta2_down;  // [rad]
+};
+
+/**
+ * @brief Workspace grid over the square [-(L1 + L2), L1 + L2]² for one link geometry
+ * 
+ * Nodes are stored tile by tile (k_workspace_tile² nodes per tile, row-major within a tile), so the four corners of
+ * a lookup almost always share a tile and a couple of cache lines.
+ */
+class WorkspaceMap {
+public:
+    /**
+     * @brief Build the grid, one tile per pool task, with batched Inverse Kinematics
+     * 
+     * @param pool 
+     * @param resolution  Cells per side
+     * @param L1 
+     * @param L2 
+     * @throws std::invalid_argument if resolution is 0 or a link length is not positive
+     */
+    explicit WorkspaceMap(ThreadPool& pool, std::size_t resolution = k_workspace_resolution, double L1 = k_link1,
+                          double L2 = k_link2);
+
+    /**
+     * @brief Read a grid written by save()
+     * 
+     * @param path 
+     * @return WorkspaceMap 
+     * @throws std::runtime_error if the file is missing, malformed or from an incompatible build
+     */
+    static WorkspaceMap load(const std::string& path);
+
+    /**
+     * @brief Load the grid cached at path if it matches resolution and geometry; otherwise build it and try to save
+     *        it there. A cache that cannot be read or written is not an error: the grid is built in memory. path
+     *        should be in a directory only the user can write (see workspace_map_cache_path()), since a file there
+     *        with a valid header and checksum is trusted.
+     * 
+     * @param path Cache file; empty to build in memory without caching
+     * @param pool 
+     * @param resolution 
+     * @param L1 
+     * @param L2 
+     * @return WorkspaceMap 
+     */
+    static WorkspaceMap load_or_build(const std::string& path, ThreadPool& pool,
+                                      std::size_t resolution = k_workspace_resolution, double L1 = k_link1,
+                                      double L2 = k_link2);
+
+    /**
+     * @brief Write the grid to path (native byte order). The grid is written to a new temporary file next to path,
+     *        which is then renamed over it, so readers never see a partial file and a file or symlink already at
+     *        path is replaced rather than written through. A missing parent directory is created, private to the
+     *        user.
+     * 
+     * @param path 
+     * @throws std::runtime_error on I/O failure
+     */
+    void save(const std::string& path) const;
+
+    double      link1() const { return L1_; }
+    double      link2() const { return L2_; }
+    std::size_t resolution() const { return resolution_; }
+    double      spacing() const { return spacing_; }  // [m]
+    std::size_t bytes() const { return nodes_.size() * sizeof(WorkspaceNode); }
+
+    /**
+     * @brief Node (ix, iy), ix and iy in [0, resolution]; node (0, 0) is at (-(L1 + L2), -(L1 + L2))
+     * 
+     */
+    const WorkspaceNode& node(std::size_t ix, std::size_t iy) const { return nodes_[index(ix, iy)]; }
+
+    /**
+     * @brief Bilinearly interpolated distance of target inside the workspace boundary (negative outside)
+     * 
+     * @param target 
+     * @return double [m]
+     */
+    double clearance(const EndEffectorPose& target) const;
+
+    /**
+     * @brief Whether target is reachable with at least clearance to the workspace boundary, from the grid
+     * 
+     * @param target 
+     * @param clearance [m]
+     * @return bool 
+     */
+    bool reachable(const EndEffectorPose& target, double clearance = 0.0) const
+    {
+        return this->clearance(target) >= clearance;
+    }
+
+    /**
+     * @brief Both IK configurations of target, bilinearly interpolated from the grid's angles: a table lookup with
+     *        no trigonometry. Accurate to O(spacing²) away from the workspace boundary and the elbow singularities;
+     *        use inverse_kinematics() where an exact solution is needed.
+     * 
+     * @param target 
+     * @return IKSolution  reachable is exact, as in inverse_kinematics(); joint velocities are zero
+     */
+    IKSolution inverse(const EndEffectorPose& target) const;
+
+    /**
+     * @brief The IK configuration of target closest to current in joint space (θ1 compared modulo 2π), so a
+     *        controller keeps its elbow branch. Unreachable targets give the arm pointing at them.
+     * 
+     * @param target 
+     * @param current 
+     * @return JointState  Joint velocities are zero
+     */
+    JointState nearest_config(const EndEffectorPose& target, const JointState& current) const;
+
+private:
+    WorkspaceMap() = default;
+
+    void        allocate();
+    std::size_t index(std::size_t ix, std::size_t iy) const
+    {
+        const std::size_t tile = (iy / k_workspace_tile) * tiles_per_side_ + ix / k_workspace_tile;
+        return tile * k_workspace_tile * k_workspace_tile + (iy % k_workspace_tile) * k_workspace_tile +
+               ix % k_workspace_tile;
+    }
+
+    double                     L1_{k_link1};
+    double                     L2_{k_link2};
+    std::size_t                resolution_{0};
+    std::size_t                tiles_per_side_{0};
+    double                     origin_{0.0};   // x and y of node (0, 0) [m]
+    double                     spacing_{0.0};  // Node spacing [m]
+    std::vector<WorkspaceNode> nodes_;
+};
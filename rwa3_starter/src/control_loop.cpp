@@ -0,0 +1,264 @@
+/**
+ * @file control_loop.cpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Control loop definitions: histogram buckets, deadline scheduling, pinning / locking and the counting
+ *         global operator new
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#include "control_loop.hpp"
+#include <pthread.h>
+#include <sys/mman.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+thread_local std::uint64_t allocation_count{0};  // Heap allocations made by this thread
+
+inline constexpr std::size_t k_sub_count{std::size_t{1} << JitterHistogram::k_sub_bits};
+
+std::size_t bucket_of(std::uint64_t value)
+{
+    if (value < k_sub_count) {
+        return static_cast<std::size_t>(value);
+    }
+    const unsigned exponent = 63U - static_cast<unsigned>(__builtin_clzll(value));
+    const unsigned shift    = exponent - JitterHistogram::k_sub_bits;
+    return ((static_cast<std::size_t>(shift) + 1) << JitterHistogram::k_sub_bits) +
+           static_cast<std::size_t>((value >> shift) & (k_sub_count - 1));
+}
+
+std::uint64_t bucket_upper(std::size_t bucket)
+{
+    if (bucket < k_sub_count) {
+        return bucket;
+    }
+    const std::size_t   shift = (bucket >> JitterHistogram::k_sub_bits) - 1;
+    const std::uint64_t lower = (k_sub_count + (bucket & (k_sub_count - 1))) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+std::uint64_t monotonic_ns()
+{
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::uint64_t>(now.tv_sec) * 1'000'000'000ULL + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+void sleep_until(std::uint64_t deadline_ns)
+{
+    timespec deadline{};
+    deadline.tv_sec  = static_cast<time_t>(deadline_ns / 1'000'000'000ULL);
+    deadline.tv_nsec = static_cast<long>(deadline_ns % 1'000'000'000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+}
+
+void* counted_malloc(std::size_t size)
+{
+    ++allocation_count;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* counted_new(std::size_t size)
+{
+    void* memory = counted_malloc(size);
+    if (memory == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+}  // namespace
+
+// ========================================================================
+// Allocation counting: replaces the global (unaligned) operator new / delete
+// ========================================================================
+
+void* operator new(std::size_t size)
+{
+    return counted_new(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return counted_new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+std::uint64_t control_loop_detail::thread_allocations()
+{
+    return allocation_count;
+}
+
+// ========================================================================
+// JitterHistogram
+// ========================================================================
+
+void JitterHistogram::record(std::uint64_t ns)
+{
+    ++counts_[bucket_of(ns)];
+    ++count_;
+    sum_ += ns;
+    max_ = std::max(max_, ns);
+}
+
+std::uint64_t JitterHistogram::percentile(double q) const
+{
+    if (count_ == 0) {
+        return 0;
+    }
+    const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count_)));
+    std::uint64_t seen{0};
+    for (std::size_t bucket{0}; bucket < k_bucket_count; ++bucket) {
+        seen += counts_[bucket];
+        if (seen >= std::max<std::uint64_t>(rank, 1)) {
+            return std::min(bucket_upper(bucket), max_);
+        }
+    }
+    return max_;
+}
+
+// ========================================================================
+// ControlLoop
+// ========================================================================
+
+void ControlLoop::begin()
+{
+    if (config_.period.count() <= 0) {
+        throw std::invalid_argument{"control loop period must be positive"};
+    }
+    stats_.cycles         = 0;
+    stats_.overruns       = 0;
+    stats_.missed_periods = 0;
+    stats_.allocations    = 0;
+    stats_.wake_latency.clear();
+    stats_.step_time.clear();
+    stats_.overrun.clear();
+
+    if (config_.lock_memory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            throw std::system_error{errno, std::system_category(), "mlockall"};
+        }
+        locked_ = true;
+    }
+    if (config_.cpu >= 0) {
+        int error = config_.cpu < CPU_SETSIZE
+                        ? pthread_getaffinity_np(pthread_self(), sizeof(saved_affinity_), &saved_affinity_)
+                        : EINVAL;
+        if (error == 0) {
+            cpu_set_t pinned;
+            CPU_ZERO(&pinned);
+            CPU_SET(config_.cpu, &pinned);
+            error = pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned);
+        }
+        if (error != 0) {
+            restore();
+            throw std::system_error{error, std::system_category(),
+                                    "pinning the control loop to CPU " + std::to_string(config_.cpu)};
+        }
+        pinned_ = true;
+    }
+
+    period_ns_   = static_cast<std::uint64_t>(config_.period.count());
+    start_ns_    = monotonic_ns() + period_ns_;
+    periods_     = 0;
+    deadline_ns_ = start_ns_;
+}
+
+void ControlLoop::wait()
+{
+    sleep_until(deadline_ns_);
+    woke_ns_ = monotonic_ns();
+    stats_.wake_latency.record(woke_ns_ > deadline_ns_ ? woke_ns_ - deadline_ns_ : 0);
+}
+
+void ControlLoop::end_cycle()
+{
+    const std::uint64_t now  = monotonic_ns();
+    const std::uint64_t next = deadline_ns_ + period_ns_;
+    stats_.step_time.record(now - woke_ns_);
+    ++stats_.cycles;
+    ++periods_;
+    if (now > next) {  // Overrun: resume at the first deadline still ahead, keeping the loop's phase
+        const std::uint64_t missed = (now - next) / period_ns_ + 1;
+        ++stats_.overruns;
+        stats_.overrun.record(now - next);
+        stats_.missed_periods += missed;
+        periods_ += missed;
+    }
+    deadline_ns_ = start_ns_ + periods_ * period_ns_;
+}
+
+void ControlLoop::restore()
+{
+    if (pinned_) {
+        pthread_setaffinity_np(pthread_self(), sizeof(saved_affinity_), &saved_affinity_);
+        pinned_ = false;
+    }
+    if (locked_) {
+        munlockall();
+        locked_ = false;
+    }
+}
+
+void ControlLoop::check_allocations() const
+{
+    if (config_.forbid_allocations && stats_.allocations != 0) {
+        throw std::logic_error{"control loop step allocated on the heap " + std::to_string(stats_.allocations) +
+                               " time(s)"};
+    }
+}
+
+double ControlLoop::scheduled_seconds() const
+{
+    return static_cast<double>(periods_ * period_ns_) * 1e-9;
+}
@@ -11,14 +11,32 @@
 #include "robot_types.hpp"
 #include "robot_kinematics.hpp"
 #include "robot_control.hpp"
+#include "thread_pool.hpp"
+#include "trajectory_eval.hpp"
+#include "trajectory_segments.hpp"
+#include "control_loop.hpp"
+#include "workspace_map.hpp"
+#include <array>
 #include <iostream>
 #include <memory>
 #include <vector>
 #include <cmath>
 #include <iomanip>
 #include <algorithm>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    // --map-cache: keep the workspace map in the per-user cache directory between runs
+    bool cache_map{false};
+    for (int arg{1}; arg < argc; ++arg) {
+        if (std::string{argv[arg]} == "--map-cache") {
+            cache_map = true;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--map-cache]\n";
+            return 1;
+        }
+    }
 
-int main() {
     std::cout << "=== Robot Kinematics & Control (Starter Skeleton) ===\n\n";
 
     // 1) Start/Goal 
@@ -31,46 +49,40 @@ int main() {
     std::cout << "Goal    ->   θ1 = "  << goal.theta1 << " rad, θ2 = "<<  goal.theta2  << " rad \n\n";
  
 
-    // 2) Trajectory container (with unique ownership requirement)
-    auto traj = std::make_unique<std::vector<JointState>>();
-    traj->reserve(k_num_samples);
-
-    // Create Trajectory points 
-    for (int i {0}; i < k_num_samples; ++i) {
-        // Force i to double for alpha calculation
-        const double alpha = static_cast<double>(i) * k_alpha_step; 
-        traj->push_back(interpolate_linear(start, goal, alpha, k_num_samples));
-    }
+    // 2) Lazy trajectory view: each JointState is interpolated on access, so the trajectory takes O(1) memory
+    const LinearTrajectoryView traj{start, goal, k_num_samples};
 
     // Print Count of Unfiltered Trajectory Points
-    std::cout << "Trajectory Points: " << traj->size()  << "\n\n";
+    std::cout << "Trajectory Points: " << traj.size()  << "\n\n";
     std::cout << "Unfiltered Trajectory (Every 5th Point Shown): \n";
 
     // Print every print_stepth JointState in the trajectory
-    for (size_t i{0}; i < traj->size(); i += print_step) {
-        std::cout << "[" << i << "]  ";
-        print_joint_state( (*traj)[i]);
+    const auto traj_shown = traj.stride(print_step);
+    for (size_t i{0}; i < traj_shown.size(); ++i) {
+        std::cout << "[" << traj_shown.sample_index(i) << "]  ";
+        print_joint_state(traj_shown[i]);
     }
 
     std::cout << '\n' << "Applying velocity-limit filter: |dθ| ≤ 1.0 rad/s" << '\n';
 
     // 3) Define & apply velocity-limit filter (lambda)
-    auto velocity_limit_lambda = [&filtered_count](const JointState& s) -> JointState {
-        JointState out = s; // Make copy before applying velocity limit in place
+    auto velocity_limit_lambda = [](const JointState& s) -> JointState {
+        JointState out = s; // Make copy before applying velocity limit
 
         // Clamp dtheta1/dtheta2 to be within [-k_vel_limit, +k_vel_limit]
         out.dtheta1 = std::clamp(out.dtheta1, -k_vel_limit, k_vel_limit);
         out.dtheta2 = std::clamp(out.dtheta2, -k_vel_limit, k_vel_limit);
-
-        // Count how many times velocity filter is applied 
-        if( out.dtheta1 != s.dtheta1 || out.dtheta2 != s.dtheta2){
-            filtered_count++;
-        }
         return out; // Return modified copy
     };
 
-    // Apply velocity limit filter limiting dtheta to +/- k_vel_limit
-    apply_filter(*traj, velocity_limit_lambda);
+    // Filtered view: the velocity limit is applied to each JointState on access
+    const auto filtered = traj.filtered(velocity_limit_lambda);
+
+    // Interpolate, filter and compute FK of every sample in one parallel pass. Chunks write their own slices of the
+    // preallocated pose batch, and the per-chunk clamp counts are summed in chunk order.
+    ThreadPool           pool;
+    EndEffectorPoseBatch pose_batch;
+    filtered_count = static_cast<int>(evaluate_trajectory(pool, traj, velocity_limit_lambda, pose_batch));
 
     // Report on filtering results
     if ( filtered_count == 0 ){
@@ -80,21 +92,34 @@ int main() {
                   << " points clamped to dθ limits \n\n";
     }
 
-    // Print End Effector Pose at every print_step step 
-    for (size_t i{0}; i < traj->size(); i += print_step) {
-        std::cout << "[" << i << "]  ";
-        print_joint_state( (*traj)[i]);
+    // Print every print_stepth filtered JointState
+    const auto filtered_shown = filtered.stride(print_step);
+    for (size_t i{0}; i < filtered_shown.size(); ++i) {
+        std::cout << "[" << filtered_shown.sample_index(i) << "]  ";
+        print_joint_state(filtered_shown[i]);
     }
     // 4) End-effector poses (shared ownership)
     auto ee_poses = std::make_shared<std::vector<EndEffectorPose>>();
-    ee_poses->reserve(traj->size());
+    ee_poses->reserve(filtered.size());
 
     // Compute end-effector poses for each JointState in the filtered trajectory
     std::cout << '\n' << "Computing end-effector poses for filtered trajectory... \n";
     std::cout << "Link Lengths: L1 = " << k_link1 << " m, L2 = " << k_link2 << " m \n";
-    for (const auto& state : *traj){
-        EndEffectorPose pose = forward_kinematics(state);
-        ee_poses->push_back(pose);
+
+    // Poses were computed by evaluate_trajectory() above (batched FK, one vectorized sincos per joint angle)
+    for (size_t i{0}; i < pose_batch.size(); ++i) {
+        ee_poses->push_back(pose_batch[i]);
+    }
+
+    // 5) Inverse kinematics round trip: solve every pose back to joint angles. θ2 stays in [-π, 0] along the
+    //    trajectory, so the elbow-up solution must reproduce the filtered JointStates.
+    IKSolutionBatch ik_batch;
+    const size_t    reachable = inverse_kinematics_batch(pose_batch, ik_batch);
+    double          ik_max_error{0.0};
+    for (size_t i{0}; i < ik_batch.size(); ++i) {
+        const JointState expected = filtered[i];
+        ik_max_error = std::max({ik_max_error, std::fabs(ik_batch.elbow_up.theta1[i] - expected.theta1),
+                                 std::fabs(ik_batch.elbow_up.theta2[i] - expected.theta2)});
     }
 
     std::cout << '\n';
@@ -104,8 +129,76 @@ int main() {
         print_pose( (*ee_poses)[i]);
     }
 
+    // 6) Time-parameterized profile: the same move as a rest-to-rest trapezoid within the velocity and acceleration
+    //    limits, compiled once and sampled at its midpoint
+    const CompiledTrajectory profile = TrajectoryBuilder{start}.append_trapezoidal(goal).compile();
+    const TrajectorySample   midpoint = profile.sample(0.5 * profile.duration());
+
+    // 7) Fixed-rate control loop: track the first 250 ms of the profile at 1 kHz. Each step samples the setpoint,
+    //    applies the velocity limit and computes FK into storage allocated before the loop starts.
+    constexpr std::uint64_t      control_cycles{250};
+    std::vector<EndEffectorPose> control_poses(control_cycles);
+    ControlLoop                  control_loop;
+    const ControlLoopStats&      control = control_loop.run(control_cycles, [&](std::uint64_t cycle, double t) {
+        const JointState setpoint = velocity_limit_lambda(profile.sample(t).state);
+        control_poses[cycle]      = forward_kinematics(setpoint);
+        return true;
+    });
+    const auto us = [](std::uint64_t ns) { return static_cast<double>(ns) * 1e-3; };
+
+    // 8) Workspace map: built once per link geometry (with --map-cache, cached in the user's cache directory), then
+    //    queried for every trajectory pose. Each lookup keeps the elbow branch of the previous configuration. The
+    //    trajectory starts fully stretched and ends fully folded, on the workspace boundary, where interpolated angles
+    //    are least accurate, so the lookup error is measured over the poses with clearance.
+    const std::string  map_path  = cache_map ? workspace_map_cache_path() : std::string{};
+    const WorkspaceMap workspace = WorkspaceMap::load_or_build(map_path, pool);
+    constexpr double   clearance{0.01};  // [m]
+    size_t             clear_poses{0};
+    double             map_max_error{0.0};
+    JointState         config = start;
+    for (size_t i{0}; i < pose_batch.size(); ++i) {
+        config = workspace.nearest_config(pose_batch[i], config);
+        if (workspace.reachable(pose_batch[i], clearance)) {
+            const JointState expected = filtered[i];
+            map_max_error = std::max({map_max_error, std::fabs(config.theta1 - expected.theta1),
+                                      std::fabs(config.theta2 - expected.theta2)});
+            ++clear_poses;
+        }
+    }
+
+    // 9) N DoF kinematics: the same compile-time chain for larger arms, link parameters as constexpr arrays. A 3-link
+    //    planar arm folds the trajectory's end configuration with a wrist joint; a 6 DoF arm (UR5 DH parameters)
+    //    is evaluated at its zero configuration.
+    constexpr std::array<double, 3>        planar3_links{k_link1, k_link2, 0.1};
+    constexpr std::array<arm::DHLink<>, 6> ur5_links{{{0.0, M_PI / 2.0, 0.089159},
+                                                      {-0.425, 0.0, 0.0},
+                                                      {-0.39225, 0.0, 0.0},
+                                                      {0.0, M_PI / 2.0, 0.10915},
+                                                      {0.0, -M_PI / 2.0, 0.09465},
+                                                      {0.0, 0.0, 0.0823}}};
+    const arm::JointState<3> planar3{{goal.theta1, goal.theta2, M_PI / 2.0}};
+    const arm::PlanarPose<>  planar3_pose = arm::forward_kinematics(planar3, planar3_links);
+    const arm::Transform<>   ur5_pose     = arm::forward_kinematics_dh(arm::JointState<6>{}, ur5_links);
+
     std::cout << "\n Summary: \n" << "-------------\n";
     std::cout << "- Total Joint States : " << ee_poses->size()  << "\n\n";
     std::cout << "- Velocity filter: active (|dθ| ≤ 1.0000) \n";
+    std::cout << "- Inverse kinematics: " << reachable << "/" << ee_poses->size()
+              << " poses reachable, elbow-up max |Δθ| = " << std::scientific << std::setprecision(1) << ik_max_error
+              << std::fixed << std::setprecision(4) << " rad\n";
+    std::cout << "- Trapezoidal profile: " << profile.duration() << " s (|dθ| ≤ " << k_vel_limit << ", |ddθ| ≤ "
+              << k_accel_limit << "), midpoint dθ2 = " << midpoint.state.dtheta2 << " rad/s\n";
+    std::cout << std::setprecision(1) << "- Control loop: " << control.cycles << " cycles at "
+              << 1e9 / static_cast<double>(control_loop.config().period.count()) << " Hz, wake latency p50/p99/max = "
+              << us(control.wake_latency.percentile(0.50)) << "/" << us(control.wake_latency.percentile(0.99)) << "/"
+              << us(control.wake_latency.max()) << " us, overruns = " << control.overruns
+              << ", heap allocations = " << control.allocations << "\n";
+    std::cout << "- Workspace map: " << workspace.resolution() << "x" << workspace.resolution() << " cells ("
+              << static_cast<double>(workspace.bytes()) / (1024.0 * 1024.0) << " MiB), " << clear_poses << "/"
+              << pose_batch.size() << " poses with " << 100.0 * clearance << " cm clearance (lookup max |Δθ| = "
+              << std::scientific << map_max_error << std::fixed << " rad)\n";
+    std::cout << std::setprecision(4) << "- N-DoF kinematics: 3-link planar pose = (" << planar3_pose.x << ", "
+              << planar3_pose.y << ") m, 6-DoF DH zero pose = (" << ur5_pose.position[0] << ", "
+              << ur5_pose.position[1] << ", " << ur5_pose.position[2] << ") m\n";
 
 }
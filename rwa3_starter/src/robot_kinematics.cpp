@@ -0,0 +1,211 @@
+/**
+ * @file robot_kinematics.cpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Batched sincos, Forward and Inverse Kinematics definitions over structure-of-arrays states
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#include "robot_kinematics.hpp"
+#include <algorithm>
+
+namespace {
+
+// pi/2 split in three parts (Cody-Waite) so k * pi/2 is subtracted without losing the low bits of the angle
+constexpr double k_two_over_pi{0.63661977236758134308};
+constexpr double k_pio2_1{1.57079632673412561417e+00};
+constexpr double k_pio2_2{6.07710050630396597660e-11};
+constexpr double k_pio2_3{2.02226624879595063154e-21};
+constexpr double k_round_bias{6755399441055744.0};  // 1.5 * 2^52: adding and subtracting rounds to an integer
+
+// Minimax polynomials on [-pi/4, pi/4] (Cephes)
+constexpr double k_sin_c[6]{1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+                            -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1};
+constexpr double k_cos_c[6]{-1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+                            2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2};
+
+/**
+ * @brief Branch-free sincos of one angle; inlined into the batch loops so they vectorize
+ * 
+ */
+inline void sincos_kernel(double angle, double& s, double& c) {
+    // Quadrant k = round(angle * 2/pi) and remainder r = angle - k * pi/2 in [-pi/4, pi/4]
+    const double k = (angle * k_two_over_pi + k_round_bias) - k_round_bias;
+    const double r = ((angle - k * k_pio2_1) - k * k_pio2_2) - k * k_pio2_3;
+
+    // Both polynomials share r and r^2
+    const double z = r * r;
+    const double ps = ((((k_sin_c[0] * z + k_sin_c[1]) * z + k_sin_c[2]) * z + k_sin_c[3]) * z + k_sin_c[4]) * z
+                      + k_sin_c[5];
+    const double pc = ((((k_cos_c[0] * z + k_cos_c[1]) * z + k_cos_c[2]) * z + k_cos_c[3]) * z + k_cos_c[4]) * z
+                      + k_cos_c[5];
+    const double sin_r = r + r * z * ps;
+    const double cos_r = 1.0 - 0.5 * z + z * z * pc;
+
+    // Quadrant mod 4 as m = k - 4 * round(k / 4) in {-2, -1, 0, 1, 2}, kept in doubles: no int conversion (which
+    // overflows for huge or NaN angles) and no conditionals (which the vectorizer keeps as branches).
+    //   quadrant 0: (s, c), 1: (c, -s), 2 or -2: (-s, -c), -1: (-c, s)
+    const double m        = k - 4.0 * ((k * 0.25 + k_round_bias) - k_round_bias);
+    const double m2       = m * m;
+    const double odd      = m2 * (4.0 - m2) / 3.0;   // 1 for m = +-1, else 0
+    const double half     = m2 * (m2 - 1.0) / 12.0;  // 1 for m = +-2, else 0
+    const double flip     = 1.0 - 2.0 * half;
+    const double sin_sign = flip * (odd * m + (1.0 - odd));
+    const double cos_sign = flip * (1.0 - odd - odd * m);
+    s = sin_sign * (odd * cos_r + (1.0 - odd) * sin_r);
+    c = cos_sign * (odd * sin_r + (1.0 - odd) * cos_r);
+}
+
+// atan rational approximation on [-0.34, 0.66] (Cephes), used by atan2_kernel
+constexpr double k_atan_p[5]{-8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+                             -1.228866684490136173410e2, -6.485021904942025371773e1};
+constexpr double k_atan_q[5]{2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+                             4.853903996359136964868e2, 1.945506571482613964425e2};
+constexpr double k_pio4{7.85398163397448309616e-1};
+constexpr double k_pio2_hi{1.57079632679489655800e+00};  // pi/2 = hi + lo
+constexpr double k_pio2_lo{6.12323399573676603587e-17};
+constexpr double k_pi_hi{3.14159265358979311600e+00};    // pi = hi + lo
+constexpr double k_pi_lo{1.22464679914735317720e-16};
+
+/**
+ * @brief Branch-free atan2: every case is computed and then selected, so the batch loops vectorize
+ * 
+ */
+inline double atan2_kernel(double y, double x) {
+    // Reduce to t = min(|x|, |y|) / max(|x|, |y|) in [0, 1], then fold t > 0.66 around 1 (atan t = pi/4 + atan u)
+    const double ax   = std::fabs(x);
+    const double ay   = std::fabs(y);
+    const bool   swap = ay > ax;
+    const double num  = swap ? ax : ay;
+    const double den  = swap ? ay : ax;
+    const bool   mid  = num > 0.66 * den;
+    const double top  = mid ? num - den : num;                      // u = (t - 1) / (t + 1) or t, in one division
+    const double bot  = mid ? num + den : (den == 0.0 ? 1.0 : den);  // 0 / 0 -> 0
+    const double u    = top / bot;
+
+    const double z = u * u;
+    const double p = (((k_atan_p[0] * z + k_atan_p[1]) * z + k_atan_p[2]) * z + k_atan_p[3]) * z + k_atan_p[4];
+    const double q = ((((z + k_atan_q[0]) * z + k_atan_q[1]) * z + k_atan_q[2]) * z + k_atan_q[3]) * z + k_atan_q[4];
+    double a = (mid ? k_pio4 : 0.0) + ((mid ? 0.5 * k_pio2_lo : 0.0) + (u + u * z * p / q));
+
+    // Undo the reductions: octant swap, left half-plane, lower half-plane
+    a = swap ? (k_pio2_hi - a) + k_pio2_lo : a;
+    a = std::copysign(1.0, x) < 0.0 ? (k_pi_hi - a) + k_pi_lo : a;  // Sign bit, so x = -0 maps to pi like std::atan2
+    return std::copysign(a, y);
+}
+
+// Recompute entries whose angle is outside the range the reduction is accurate for (or not finite)
+void fix_large_angles(const double* angles, std::size_t n, double* sin_out, double* cos_out) {
+    for (std::size_t i{0}; i < n; ++i) {
+        if (!(std::fabs(angles[i]) <= k_sincos_max_arg)) {
+            sin_out[i] = std::sin(angles[i]);
+            cos_out[i] = std::cos(angles[i]);
+        }
+    }
+}
+
+}  // namespace
+
+void sincos_batch(const double* angles, std::size_t n, double* sin_out, double* cos_out)
+{
+    for (std::size_t i{0}; i < n; ++i) {
+        sincos_kernel(angles[i], sin_out[i], cos_out[i]);
+    }
+    fix_large_angles(angles, n, sin_out, cos_out);
+}
+
+void forward_kinematics_batch(const double* theta1, const double* theta2, std::size_t n, double* x, double* y,
+                              double L1, double L2)
+{
+    for (std::size_t i{0}; i < n; ++i) {
+        double s1, c1, s12, c12;
+        sincos_kernel(theta1[i], s1, c1);
+        sincos_kernel(theta1[i] + theta2[i], s12, c12);
+        x[i] = L1 * c1 + L2 * c12;
+        y[i] = L1 * s1 + L2 * s12;
+    }
+    for (std::size_t i{0}; i < n; ++i) {  // Rare: angles the reduction does not cover are redone with libm
+        const double theta12 = theta1[i] + theta2[i];
+        if (!(std::fabs(theta1[i]) <= k_sincos_max_arg && std::fabs(theta12) <= k_sincos_max_arg)) {
+            x[i] = L1 * std::cos(theta1[i]) + L2 * std::cos(theta12);
+            y[i] = L1 * std::sin(theta1[i]) + L2 * std::sin(theta12);
+        }
+    }
+}
+
+void forward_kinematics_batch(const JointStateBatch& states, EndEffectorPoseBatch& poses, double L1, double L2)
+{
+    poses.resize(states.size());
+    forward_kinematics_batch(states.theta1.data(), states.theta2.data(), states.size(), poses.x.data(),
+                             poses.y.data(), L1, L2);
+}
+
+IKSolution inverse_kinematics(const EndEffectorPose& target, double L1, double L2)
+{
+    const double c2_raw    = (target.x * target.x + target.y * target.y - (L1 * L1 + L2 * L2)) / (2.0 * L1 * L2);
+    const bool   reachable = std::fabs(c2_raw) <= 1.0 + k_ik_reach_tol;
+    const double c2        = std::clamp(c2_raw, -1.0, 1.0);  // Unreachable: fully stretched or folded towards it
+    const double s2        = std::sqrt((1.0 - c2) * (1.0 + c2));
+    const double k1        = L1 + L2 * c2;
+    const double k2        = L2 * s2;
+
+    // θ1 = atan2(y, x) - atan2(±k2, k1), combined into one atan2 so it stays in (-pi, pi]
+    IKSolution solution{};
+    solution.elbow_up.theta1   = std::atan2(target.y * k1 + target.x * k2, target.x * k1 - target.y * k2);
+    solution.elbow_up.theta2   = -std::atan2(s2, c2);
+    solution.elbow_down.theta1 = std::atan2(target.y * k1 - target.x * k2, target.x * k1 + target.y * k2);
+    solution.elbow_down.theta2 = std::atan2(s2, c2);
+    solution.reachable         = reachable;
+    return solution;
+}
+
+std::size_t inverse_kinematics_batch(const double* x, const double* y, std::size_t n, double* theta1_up,
+                                     double* theta2_up, double* theta1_down, double* theta2_down,
+                                     std::uint8_t* reachable, double L1, double L2)
+{
+    const double offset = L1 * L1 + L2 * L2;
+    const double scale  = 2.0 * L1 * L2;
+
+    // cos(θ2) of target i, and clamped to [-1, 1]: unreachable targets get the fully stretched or folded arm
+    auto cos_theta2 = [&](std::size_t i) { return (x[i] * x[i] + y[i] * y[i] - offset) / scale; };
+    auto cos_theta2_clamped = [&](std::size_t i) { return std::min(std::max(cos_theta2(i), -1.0), 1.0); };
+
+    // Separate passes with few outputs each: the vectorizer's runtime aliasing checks stay within its limit, and the
+    // byte-sized reachability flags (which do not vectorize alongside doubles) stay out of the atan2 loops
+    for (std::size_t i{0}; i < n; ++i) {  // Elbow angles
+        const double c2     = cos_theta2_clamped(i);
+        const double theta2 = atan2_kernel(std::sqrt((1.0 - c2) * (1.0 + c2)), c2);
+        theta2_up[i]   = -theta2;
+        theta2_down[i] = theta2;
+    }
+    for (std::size_t i{0}; i < n; ++i) {  // Shoulder angles
+        const double c2 = cos_theta2_clamped(i);
+        const double k1 = L1 + L2 * c2;
+        const double k2 = L2 * std::sqrt((1.0 - c2) * (1.0 + c2));
+        theta1_up[i]   = atan2_kernel(y[i] * k1 + x[i] * k2, x[i] * k1 - y[i] * k2);
+        theta1_down[i] = atan2_kernel(y[i] * k1 - x[i] * k2, x[i] * k1 + y[i] * k2);
+    }
+
+    std::size_t count{0};
+    for (std::size_t i{0}; i < n; ++i) {  // Reachability
+        reachable[i] = std::fabs(cos_theta2(i)) <= 1.0 + k_ik_reach_tol;
+        count += reachable[i];
+    }
+    return count;
+}
+
+std::size_t inverse_kinematics_batch(const EndEffectorPoseBatch& targets, IKSolutionBatch& solutions, double L1,
+                                     double L2)
+{
+    const std::size_t n = targets.size();
+    solutions.resize(n);
+    std::fill(solutions.elbow_up.dtheta1.begin(), solutions.elbow_up.dtheta1.end(), 0.0);
+    std::fill(solutions.elbow_up.dtheta2.begin(), solutions.elbow_up.dtheta2.end(), 0.0);
+    std::fill(solutions.elbow_down.dtheta1.begin(), solutions.elbow_down.dtheta1.end(), 0.0);
+    std::fill(solutions.elbow_down.dtheta2.begin(), solutions.elbow_down.dtheta2.end(), 0.0);
+    return inverse_kinematics_batch(targets.x.data(), targets.y.data(), n, solutions.elbow_up.theta1.data(),
+                                    solutions.elbow_up.theta2.data(), solutions.elbow_down.theta1.data(),
+                                    solutions.elbow_down.theta2.data(), solutions.reachable.data(), L1, L2);
+}
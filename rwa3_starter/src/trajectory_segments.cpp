@@ -0,0 +1,188 @@
+/**
+ * @file trajectory_segments.cpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Segment coefficient and time-bin index definitions for compiled trajectories
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#include "trajectory_segments.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t k_max_bins{1U << 20};  // Bins per trajectory (bounds the index for very fine trajectories)
+
+using Coefficients = std::array<double, 6>;
+
+// p(τ) = p0 + (p1 - p0) τ / T
+Coefficients linear_coefficients(double p0, double p1, double T)
+{
+    return {p0, (p1 - p0) / T, 0.0, 0.0, 0.0, 0.0};
+}
+
+// Hermite cubic: p(0) = p0, p(T) = p1, p'(0) = v0, p'(T) = v1
+Coefficients cubic_coefficients(double p0, double p1, double v0, double v1, double T)
+{
+    const double h = p1 - p0;
+    return {p0, v0, (3.0 * h - (2.0 * v0 + v1) * T) / (T * T), (-2.0 * h + (v0 + v1) * T) / (T * T * T), 0.0, 0.0};
+}
+
+// Quintic: as the cubic, plus p''(0) = p''(T) = 0
+Coefficients quintic_coefficients(double p0, double p1, double v0, double v1, double T)
+{
+    const double h  = p1 - p0;
+    const double T3 = T * T * T;
+    return {p0,
+            v0,
+            0.0,
+            (20.0 * h - (8.0 * v1 + 12.0 * v0) * T) / (2.0 * T3),
+            (-30.0 * h + (14.0 * v1 + 16.0 * v0) * T) / (2.0 * T3 * T),
+            (12.0 * h - 6.0 * (v1 + v0) * T) / (2.0 * T3 * T * T)};
+}
+
+// Shortest rest-to-rest trapezoid (or triangle) over distance d: total time T and acceleration time ta
+void trapezoid_times(double d, double v_max, double a_max, double& T, double& ta)
+{
+    if (d * a_max >= v_max * v_max) {  // Reaches v_max: accelerate, cruise, decelerate
+        ta = v_max / a_max;
+        T  = d / v_max + ta;
+    } else {                           // Triangle: decelerates before reaching v_max
+        ta = std::sqrt(d / a_max);
+        T  = 2.0 * ta;
+    }
+}
+
+}  // namespace
+
+TrajectoryBuilder& TrajectoryBuilder::append(const JointState& goal, double duration, SegmentProfile profile)
+{
+    if (!(duration > 0.0)) {
+        throw std::invalid_argument{"segment duration must be positive"};
+    }
+    std::array<Coefficients, 2> pos{};
+    switch (profile) {
+        case SegmentProfile::Linear:
+            pos[0] = linear_coefficients(current_.theta1, goal.theta1, duration);
+            pos[1] = linear_coefficients(current_.theta2, goal.theta2, duration);
+            break;
+        case SegmentProfile::Cubic:
+            pos[0] = cubic_coefficients(current_.theta1, goal.theta1, current_.dtheta1, goal.dtheta1, duration);
+            pos[1] = cubic_coefficients(current_.theta2, goal.theta2, current_.dtheta2, goal.dtheta2, duration);
+            break;
+        case SegmentProfile::Quintic:
+            pos[0] = quintic_coefficients(current_.theta1, goal.theta1, current_.dtheta1, goal.dtheta1, duration);
+            pos[1] = quintic_coefficients(current_.theta2, goal.theta2, current_.dtheta2, goal.dtheta2, duration);
+            break;
+        case SegmentProfile::Trapezoidal:
+            throw std::invalid_argument{"trapezoidal segments are timed by their limits: use append_trapezoidal()"};
+    }
+    add_piece(duration, pos);
+
+    current_ = goal;
+    if (profile == SegmentProfile::Linear) {  // Ends at the linear segment's velocity, not goal's
+        current_.dtheta1 = pos[0][1];
+        current_.dtheta2 = pos[1][1];
+    }
+    return *this;
+}
+
+TrajectoryBuilder& TrajectoryBuilder::append_trapezoidal(const JointState& goal, double max_velocity,
+                                                         double max_acceleration)
+{
+    if (!(max_velocity > 0.0) || !(max_acceleration > 0.0)) {
+        throw std::invalid_argument{"trapezoidal limits must be positive"};
+    }
+    const double p0[2]{current_.theta1, current_.theta2};
+    const double p1[2]{goal.theta1, goal.theta2};
+
+    // The joint with the longest move sets the timing; the other is scaled to the same switching times
+    double T{0.0};
+    double ta{0.0};
+    for (int j{0}; j < 2; ++j) {
+        double Tj{0.0};
+        double taj{0.0};
+        trapezoid_times(std::fabs(p1[j] - p0[j]), max_velocity, max_acceleration, Tj, taj);
+        if (Tj > T) {
+            T  = Tj;
+            ta = taj;
+        }
+    }
+
+    if (T > 0.0) {
+        const double tc = T - 2.0 * ta;  // Cruise time (0 for a triangle)
+        std::array<Coefficients, 2> accel{};
+        std::array<Coefficients, 2> cruise{};
+        std::array<Coefficients, 2> decel{};
+        for (int j{0}; j < 2; ++j) {
+            const double v = (p1[j] - p0[j]) / (T - ta);  // Peak velocity
+            const double a = v / ta;
+            accel[j]  = {p0[j], 0.0, 0.5 * a, 0.0, 0.0, 0.0};
+            cruise[j] = {p0[j] + 0.5 * a * ta * ta, v, 0.0, 0.0, 0.0, 0.0};
+            decel[j]  = {p1[j] - 0.5 * a * ta * ta, v, -0.5 * a, 0.0, 0.0, 0.0};
+        }
+        add_piece(ta, accel);
+        if (tc > 0.0) {
+            add_piece(tc, cruise);
+        }
+        add_piece(ta, decel);
+    }
+
+    current_         = goal;
+    current_.dtheta1 = 0.0;  // Rest to rest
+    current_.dtheta2 = 0.0;
+    return *this;
+}
+
+void TrajectoryBuilder::add_piece(double duration, const std::array<Coefficients, 2>& pos)
+{
+    Piece piece{};
+    piece.t_start = t_end_;
+    piece.t_end   = t_end_ + duration;
+    piece.pos     = pos;
+    for (std::size_t j{0}; j < 2; ++j) {  // Derivative coefficients: k c_k, k (k - 1) c_k
+        for (std::size_t k{1}; k < 6; ++k) {
+            piece.vel[j][k - 1] = static_cast<double>(k) * pos[j][k];
+        }
+        for (std::size_t k{2}; k < 6; ++k) {
+            piece.acc[j][k - 2] = static_cast<double>(k * (k - 1)) * pos[j][k];
+        }
+    }
+    pieces_.push_back(piece);
+    t_end_ = piece.t_end;
+}
+
+CompiledTrajectory TrajectoryBuilder::compile() const
+{
+    if (pieces_.empty()) {
+        throw std::invalid_argument{"trajectory has no segments"};
+    }
+    CompiledTrajectory out;
+    out.pieces_   = pieces_;
+    out.duration_ = t_end_;
+
+    // Bin width: the shortest piece, so each bin overlaps at most two pieces
+    double shortest = std::numeric_limits<double>::infinity();
+    for (const Piece& piece : pieces_) {
+        shortest = std::min(shortest, piece.t_end - piece.t_start);
+    }
+    const double      bins_wanted = std::ceil(t_end_ / shortest);
+    const std::size_t bins = static_cast<std::size_t>(std::clamp(bins_wanted, 1.0, static_cast<double>(k_max_bins)));
+    out.inv_bin_width_     = static_cast<double>(bins) / t_end_;
+    out.bin_piece_.resize(bins);
+
+    std::size_t piece{0};
+    for (std::size_t bin{0}; bin < bins; ++bin) {
+        const double t = static_cast<double>(bin) / out.inv_bin_width_;
+        while (piece + 1 < pieces_.size() && t >= pieces_[piece].t_end) {
+            ++piece;
+        }
+        out.bin_piece_[bin] = static_cast<std::uint32_t>(piece);
+    }
+    return out;
+}
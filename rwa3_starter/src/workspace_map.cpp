@@ -0,0 +1,305 @@
+/**
+ * @file workspace_map.cpp
+ * @author Chris Collins (ccollin5@umd.edu)
+ * @brief  Workspace grid definitions: parallel build, bilinear lookups and serialization
+ * @version 0.1
+ * @date 2025-10-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#include "workspace_map.hpp"
+#include "robot_kinematics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+constexpr char          k_map_magic[8]{'R', 'W', 'A', '3', 'W', 'M', 'A', 'P'};
+constexpr std::uint32_t k_map_version{2};  // 2: FNV-1a checksum of the nodes in the header
+
+/**
+ * @brief Cell of a grid containing a point, and the point's position inside it
+ * 
+ */
+struct GridCell {
+    std::size_t ix;
+    std::size_t iy;
+    double      u;  // [0, 1] from node ix to ix + 1
+    double      v;  // [0, 1] from node iy to iy + 1
+};
+
+GridCell locate(double x, double y, double origin, double spacing, std::size_t resolution)
+{
+    const double limit = static_cast<double>(resolution);
+    const double fx    = std::clamp((x - origin) / spacing, 0.0, limit);
+    const double fy    = std::clamp((y - origin) / spacing, 0.0, limit);
+    const auto   ix    = std::min(static_cast<std::size_t>(fx), resolution - 1);
+    const auto   iy    = std::min(static_cast<std::size_t>(fy), resolution - 1);
+    return GridCell{ix, iy, fx - static_cast<double>(ix), fy - static_cast<double>(iy)};
+}
+
+double bilinear(double v00, double v10, double v01, double v11, double u, double v)
+{
+    const double bottom = v00 + (v10 - v00) * u;
+    const double top    = v01 + (v11 - v01) * u;
+    return bottom + (top - bottom) * v;
+}
+
+// a moved by a multiple of 2π to within π of reference (table angles are in [-π, π])
+double unwrap(double a, double reference)
+{
+    a += a - reference > M_PI ? -2.0 * M_PI : 0.0;
+    a += reference - a > M_PI ? 2.0 * M_PI : 0.0;
+    return a;
+}
+
+// a wrapped to [-π, π] after unwrapped interpolation
+double wrap(double a)
+{
+    return a > M_PI ? a - 2.0 * M_PI : (a < -M_PI ? a + 2.0 * M_PI : a);
+}
+
+double joint_distance(const JointState& a, const JointState& b)
+{
+    return std::hypot(std::remainder(a.theta1 - b.theta1, 2.0 * M_PI), a.theta2 - b.theta2);
+}
+
+// 64-bit FNV-1a of a byte range, so a damaged or truncated-and-padded cache is rejected
+std::uint64_t checksum(const void* data, std::size_t size)
+{
+    const auto*   bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t hash  = 0xcbf29ce484222325ULL;
+    for (std::size_t i{0}; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+}  // namespace
+
+std::string workspace_map_cache_path()
+{
+    const char*           xdg  = std::getenv("XDG_CACHE_HOME");
+    const char*           home = std::getenv("HOME");
+    std::filesystem::path base;
+    if (xdg != nullptr && std::filesystem::path{xdg}.is_absolute()) {
+        base = xdg;
+    } else if (home != nullptr && std::filesystem::path{home}.is_absolute()) {
+        base = std::filesystem::path{home} / ".cache";
+    } else {
+        return std::string{};
+    }
+    return (base / "rwa3" / "workspace_map.bin").string();
+}
+
+WorkspaceMap::WorkspaceMap(ThreadPool& pool, std::size_t resolution, double L1, double L2)
+    : L1_{L1}, L2_{L2}, resolution_{resolution}
+{
+    if (resolution == 0) {
+        throw std::invalid_argument{"workspace map resolution must be at least 1"};
+    }
+    if (!(L1 > 0.0) || !(L2 > 0.0)) {
+        throw std::invalid_argument{"link lengths must be positive"};
+    }
+    allocate();
+
+    constexpr std::size_t tile_nodes = k_workspace_tile * k_workspace_tile;
+    const double          inner      = std::fabs(L1_ - L2_);
+    const double          outer      = L1_ + L2_;
+    pool.run(tiles_per_side_ * tiles_per_side_, [&](std::size_t tile) {
+        const std::size_t tx = tile % tiles_per_side_;
+        const std::size_t ty = tile / tiles_per_side_;
+        double            x[tile_nodes];
+        double            y[tile_nodes];
+        double            theta1_up[tile_nodes];
+        double            theta2_up[tile_nodes];
+        double            theta1_down[tile_nodes];
+        double            theta2_down[tile_nodes];
+        std::uint8_t      reachable[tile_nodes];
+        for (std::size_t j{0}; j < tile_nodes; ++j) {  // Tiles past the last node row/column are padding
+            x[j] = origin_ + static_cast<double>(tx * k_workspace_tile + j % k_workspace_tile) * spacing_;
+            y[j] = origin_ + static_cast<double>(ty * k_workspace_tile + j / k_workspace_tile) * spacing_;
+        }
+        inverse_kinematics_batch(x, y, tile_nodes, theta1_up, theta2_up, theta1_down, theta2_down, reachable, L1_,
+                                 L2_);
+
+        WorkspaceNode* out = &nodes_[tile * tile_nodes];  // Node j of the tile, as ordered by index()
+        for (std::size_t j{0}; j < tile_nodes; ++j) {
+            const double r = std::hypot(x[j], y[j]);
+            out[j]         = WorkspaceNode{static_cast<float>(std::min(r - inner, outer - r)),
+                                           static_cast<float>(theta1_up[j]), static_cast<float>(theta2_up[j]),
+                                           static_cast<float>(theta1_down[j]), static_cast<float>(theta2_down[j])};
+        }
+    });
+}
+
+void WorkspaceMap::allocate()
+{
+    const std::size_t nodes_per_side = resolution_ + 1;
+    tiles_per_side_                  = (nodes_per_side + k_workspace_tile - 1) / k_workspace_tile;
+    origin_                          = -(L1_ + L2_);
+    spacing_                         = 2.0 * (L1_ + L2_) / static_cast<double>(resolution_);
+    nodes_.resize(tiles_per_side_ * tiles_per_side_ * k_workspace_tile * k_workspace_tile);
+}
+
+double WorkspaceMap::clearance(const EndEffectorPose& target) const
+{
+    const GridCell       cell = locate(target.x, target.y, origin_, spacing_, resolution_);
+    const WorkspaceNode& n00  = node(cell.ix, cell.iy);
+    const WorkspaceNode& n10  = node(cell.ix + 1, cell.iy);
+    const WorkspaceNode& n01  = node(cell.ix, cell.iy + 1);
+    const WorkspaceNode& n11  = node(cell.ix + 1, cell.iy + 1);
+    const double inside = bilinear(n00.clearance, n10.clearance, n01.clearance, n11.clearance, cell.u, cell.v);
+
+    // Outside the grid: the clearance at the nearest grid point, less the distance to it
+    const double gx = origin_ + (static_cast<double>(cell.ix) + cell.u) * spacing_;
+    const double gy = origin_ + (static_cast<double>(cell.iy) + cell.v) * spacing_;
+    return inside - std::hypot(target.x - gx, target.y - gy);
+}
+
+IKSolution WorkspaceMap::inverse(const EndEffectorPose& target) const
+{
+    const GridCell       cell = locate(target.x, target.y, origin_, spacing_, resolution_);
+    const WorkspaceNode& n00  = node(cell.ix, cell.iy);
+    const WorkspaceNode& n10  = node(cell.ix + 1, cell.iy);
+    const WorkspaceNode& n01  = node(cell.ix, cell.iy + 1);
+    const WorkspaceNode& n11  = node(cell.ix + 1, cell.iy + 1);
+
+    // θ1 wraps at ±π: corners are unwrapped around the first before interpolating
+    const double theta1_up =
+        bilinear(n00.theta1_up, unwrap(n10.theta1_up, n00.theta1_up), unwrap(n01.theta1_up, n00.theta1_up),
+                 unwrap(n11.theta1_up, n00.theta1_up), cell.u, cell.v);
+    const double theta1_down =
+        bilinear(n00.theta1_down, unwrap(n10.theta1_down, n00.theta1_down), unwrap(n01.theta1_down, n00.theta1_down),
+                 unwrap(n11.theta1_down, n00.theta1_down), cell.u, cell.v);
+    const double theta2_up   = bilinear(n00.theta2_up, n10.theta2_up, n01.theta2_up, n11.theta2_up, cell.u, cell.v);
+    const double theta2_down =
+        bilinear(n00.theta2_down, n10.theta2_down, n01.theta2_down, n11.theta2_down, cell.u, cell.v);
+
+    const double c2 = (target.x * target.x + target.y * target.y - L1_ * L1_ - L2_ * L2_) / (2.0 * L1_ * L2_);
+    return IKSolution{JointState{wrap(theta1_up), theta2_up}, JointState{wrap(theta1_down), theta2_down},
+                      std::fabs(c2) <= 1.0 + k_ik_reach_tol};
+}
+
+JointState WorkspaceMap::nearest_config(const EndEffectorPose& target, const JointState& current) const
+{
+    const IKSolution solution = inverse(target);
+    return joint_distance(solution.elbow_up, current) <= joint_distance(solution.elbow_down, current)
+               ? solution.elbow_up
+               : solution.elbow_down;
+}
+
+void WorkspaceMap::save(const std::string& path) const
+{
+    namespace fs = std::filesystem;
+    const fs::path  target{path};
+    const fs::path  dir = target.parent_path();
+    std::error_code error;
+    if (!dir.empty() && !fs::is_directory(dir, error)) {
+        if (!fs::create_directories(dir, error)) {
+            throw std::runtime_error{"cannot create directory '" + dir.string() + "': " + error.message()};
+        }
+        fs::permissions(dir, fs::perms::owner_all, fs::perm_options::replace, error);  // Nobody else may add files
+    }
+
+    // A fresh name per call: concurrent writers never share a temporary, and the last rename wins
+    std::random_device  random;
+    const std::uint64_t tag = (static_cast<std::uint64_t>(random()) << 32) ^ random();
+    const fs::path      temp{path + ".tmp" + std::to_string(tag)};
+    {
+        std::ofstream out{temp, std::ios::binary | std::ios::trunc};
+        if (!out) {
+            throw std::runtime_error{"cannot create workspace map '" + temp.string() + "'"};
+        }
+        const std::uint32_t version   = k_map_version;
+        const std::uint32_t node_size = sizeof(WorkspaceNode);
+        const std::uint64_t cells     = resolution_;
+        const std::uint64_t sum       = checksum(nodes_.data(), bytes());
+        out.write(k_map_magic, sizeof(k_map_magic));
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char*>(&node_size), sizeof(node_size));
+        out.write(reinterpret_cast<const char*>(&cells), sizeof(cells));
+        out.write(reinterpret_cast<const char*>(&L1_), sizeof(L1_));
+        out.write(reinterpret_cast<const char*>(&L2_), sizeof(L2_));
+        out.write(reinterpret_cast<const char*>(&sum), sizeof(sum));
+        out.write(reinterpret_cast<const char*>(nodes_.data()), static_cast<std::streamsize>(bytes()));
+        out.close();
+        if (!out) {
+            fs::remove(temp, error);
+            throw std::runtime_error{"failed writing workspace map '" + temp.string() + "'"};
+        }
+    }
+    fs::rename(temp, target, error);
+    if (error) {
+        fs::remove(temp, error);
+        throw std::runtime_error{"cannot replace workspace map '" + path + "'"};
+    }
+}
+
+WorkspaceMap WorkspaceMap::load(const std::string& path)
+{
+    std::ifstream in{path, std::ios::binary};
+    if (!in) {
+        throw std::runtime_error{"cannot open workspace map '" + path + "'"};
+    }
+    char          magic[sizeof(k_map_magic)]{};
+    std::uint32_t version{0};
+    std::uint32_t node_size{0};
+    std::uint64_t cells{0};
+    std::uint64_t sum{0};
+    WorkspaceMap  map;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&node_size), sizeof(node_size));
+    in.read(reinterpret_cast<char*>(&cells), sizeof(cells));
+    in.read(reinterpret_cast<char*>(&map.L1_), sizeof(map.L1_));
+    in.read(reinterpret_cast<char*>(&map.L2_), sizeof(map.L2_));
+    in.read(reinterpret_cast<char*>(&sum), sizeof(sum));
+    if (!in || std::memcmp(magic, k_map_magic, sizeof(magic)) != 0) {
+        throw std::runtime_error{"'" + path + "' is not a workspace map"};
+    }
+    if (version != k_map_version || node_size != sizeof(WorkspaceNode) || cells == 0 || cells > (1U << 16) ||
+        !(map.L1_ > 0.0) || !(map.L2_ > 0.0)) {
+        throw std::runtime_error{"workspace map '" + path + "' is from an incompatible build"};
+    }
+
+    map.resolution_ = static_cast<std::size_t>(cells);
+    map.allocate();
+    in.read(reinterpret_cast<char*>(map.nodes_.data()), static_cast<std::streamsize>(map.bytes()));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        throw std::runtime_error{"workspace map '" + path + "' has the wrong size"};
+    }
+    if (checksum(map.nodes_.data(), map.bytes()) != sum) {
+        throw std::runtime_error{"workspace map '" + path + "' is damaged"};
+    }
+    return map;
+}
+
+WorkspaceMap WorkspaceMap::load_or_build(const std::string& path, ThreadPool& pool, std::size_t resolution, double L1,
+                                         double L2)
+{
+    if (path.empty()) {
+        return WorkspaceMap{pool, resolution, L1, L2};
+    }
+    try {
+        WorkspaceMap map = load(path);
+        if (map.resolution_ == resolution && map.L1_ == L1 && map.L2_ == L2) {
+            return map;
+        }
+    } catch (const std::exception&) {
+        // Missing, stale, damaged or unreadable cache: rebuild it
+    }
+    WorkspaceMap map{pool, resolution, L1, L2};
+    try {
+        map.save(path);
+    } catch (const std::exception&) {
+        // The cache is only an optimization: keep the in-memory grid
+    }
+    return map;
+}